@@ -4,6 +4,7 @@
  */
 
 #include "ch422g.h"
+#include "i2c_bus.h"
 #include "esp_log.h"
 #include "esp_check.h"
 #include "freertos/FreeRTOS.h"
@@ -21,6 +22,21 @@ struct ch422g_dev_t {
     uint8_t current_output;     ///< Cache of current output state
 };
 
+/**
+ * @brief Write one CH422G register (each register has its own I2C address)
+ *
+ * Goes through the bus manager once it is running, so expander writes never
+ * interleave with touch reads and queued writes to a register coalesce.
+ */
+static esp_err_t ch422g_write_reg(ch422g_handle_t handle, uint8_t addr, uint8_t value)
+{
+    if (i2c_bus_is_running()) {
+        return i2c_bus_write_byte(I2C_BUS_DEV_EXPANDER, addr, value);
+    }
+    return i2c_master_write_to_device(handle->i2c_port, addr, &value, 1,
+                                      pdMS_TO_TICKS(handle->timeout_ms));
+}
+
 esp_err_t ch422g_init(const ch422g_config_t *config, ch422g_handle_t *handle)
 {
     ESP_RETURN_ON_FALSE(config != NULL, ESP_ERR_INVALID_ARG, TAG, "config is NULL");
@@ -56,14 +72,7 @@ esp_err_t ch422g_set_output_mode(ch422g_handle_t handle)
 {
     ESP_RETURN_ON_FALSE(handle != NULL, ESP_ERR_INVALID_ARG, TAG, "handle is NULL");
 
-    uint8_t cmd = CH422G_OUTPUT_MODE;
-    esp_err_t ret = i2c_master_write_to_device(
-        handle->i2c_port,
-        CH422G_MODE_ADDR,
-        &cmd,
-        1,
-        pdMS_TO_TICKS(handle->timeout_ms)
-    );
+    esp_err_t ret = ch422g_write_reg(handle, CH422G_MODE_ADDR, CH422G_OUTPUT_MODE);
     ESP_RETURN_ON_ERROR(ret, TAG, "Failed to set output mode");
 
     return ESP_OK;
@@ -73,16 +82,20 @@ esp_err_t ch422g_write_output(ch422g_handle_t handle, uint8_t value)
 {
     ESP_RETURN_ON_FALSE(handle != NULL, ESP_ERR_INVALID_ARG, TAG, "handle is NULL");
 
-    esp_err_t ret = i2c_master_write_to_device(
-        handle->i2c_port,
-        CH422G_OUTPUT_ADDR,
-        &value,
-        1,
-        pdMS_TO_TICKS(handle->timeout_ms)
-    );
-    ESP_RETURN_ON_ERROR(ret, TAG, "Failed to write output register");
-
+    // Cache before writing: concurrent writes are coalesced by the bus manager
+    // and the last value requested is the one that reaches the expander
+    uint8_t previous = handle->current_output;
     handle->current_output = value;
+    esp_err_t ret = ch422g_write_reg(handle, CH422G_OUTPUT_ADDR, value);
+    if (ret != ESP_OK) {
+        // The chip did not get this value; undo it unless a later write replaced it
+        if (handle->current_output == value) {
+            handle->current_output = previous;
+        }
+        ESP_LOGE(TAG, "Failed to write output register: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
     return ESP_OK;
 }
 
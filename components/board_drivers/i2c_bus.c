@@ -0,0 +1,283 @@
+/**
+ * @file i2c_bus.c
+ * @brief Shared I2C bus manager implementation
+ */
+
+#include "i2c_bus.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+static const char *TAG = "i2c_bus";
+
+#define I2C_BUS_TASK_STACK_SIZE     3072
+#define I2C_BUS_QUEUE_LEN           8       ///< Per device
+#define I2C_BUS_MAX_QUEUED_WRITES   4       ///< Byte writes open for coalescing
+
+static const char *const s_dev_names[I2C_BUS_DEV_COUNT] = {
+    [I2C_BUS_DEV_TOUCH] = "touch",
+    [I2C_BUS_DEV_EXPANDER] = "expander",
+};
+
+/**
+ * @brief A caller blocked on a transaction (lives on the caller's stack)
+ */
+typedef struct waiter {
+    StaticSemaphore_t done_buf;
+    SemaphoreHandle_t done;
+    esp_err_t result;
+    struct waiter *next;
+} waiter_t;
+
+/**
+ * @brief One queued transaction (lives on the submitting caller's stack)
+ */
+typedef struct {
+    i2c_bus_dev_t dev;
+    uint8_t addr;
+    uint8_t value;                  ///< Byte writes: may change while queued
+    esp_err_t (*fn)(void *ctx);     ///< NULL for byte writes
+    void *ctx;
+    int64_t submit_us;
+    waiter_t leader;                ///< The caller that queued the request
+    waiter_t *followers;            ///< Callers whose writes were coalesced into it
+} request_t;
+
+static i2c_bus_config_t s_config;
+static TaskHandle_t s_task = NULL;
+static QueueHandle_t s_queues[I2C_BUS_DEV_COUNT];
+static SemaphoreHandle_t s_work = NULL;         ///< Counts queued requests
+
+// Protects s_queued_writes, request value/followers, and s_stats
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static request_t *s_queued_writes[I2C_BUS_MAX_QUEUED_WRITES];
+static i2c_bus_stats_t s_stats[I2C_BUS_DEV_COUNT];
+
+static void waiter_init(waiter_t *waiter)
+{
+    waiter->done = xSemaphoreCreateBinaryStatic(&waiter->done_buf);
+    waiter->result = ESP_FAIL;
+    waiter->next = NULL;
+}
+
+static esp_err_t write_byte_direct(uint8_t addr, uint8_t value)
+{
+    return i2c_master_write_to_device(s_config.i2c_port, addr, &value, 1,
+                                      pdMS_TO_TICKS(s_config.timeout_ms));
+}
+
+static void record_result(i2c_bus_dev_t dev, esp_err_t ret, int64_t submit_us)
+{
+    uint32_t latency_us = (uint32_t)(esp_timer_get_time() - submit_us);
+
+    taskENTER_CRITICAL(&s_lock);
+    i2c_bus_stats_t *stats = &s_stats[dev];
+    stats->transactions++;
+    if (ret != ESP_OK) {
+        stats->errors++;
+        stats->last_error = ret;
+        if (ret == ESP_ERR_TIMEOUT) {
+            stats->timeouts++;
+        }
+    }
+    if (latency_us > stats->max_latency_us) {
+        stats->max_latency_us = latency_us;
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "%s transaction failed: %s", s_dev_names[dev], esp_err_to_name(ret));
+    }
+}
+
+/**
+ * @brief Perform one request and release its callers (owner task)
+ */
+static void execute(request_t *req)
+{
+    esp_err_t ret;
+    waiter_t *followers = NULL;
+
+    if (req->fn) {
+        ret = req->fn(req->ctx);
+    } else {
+        // Close the request for coalescing; later writes queue a new one
+        taskENTER_CRITICAL(&s_lock);
+        for (int i = 0; i < I2C_BUS_MAX_QUEUED_WRITES; i++) {
+            if (s_queued_writes[i] == req) {
+                s_queued_writes[i] = NULL;
+            }
+        }
+        uint8_t value = req->value;
+        followers = req->followers;
+        taskEXIT_CRITICAL(&s_lock);
+
+        ret = write_byte_direct(req->addr, value);
+    }
+
+    record_result(req->dev, ret, req->submit_us);
+
+    // Release followers first: req is invalid once the leader returns
+    while (followers) {
+        waiter_t *next = followers->next;
+        followers->result = ret;
+        xSemaphoreGive(followers->done);
+        followers = next;
+    }
+    req->leader.result = ret;
+    xSemaphoreGive(req->leader.done);
+}
+
+static void i2c_bus_task(void *arg)
+{
+    while (1) {
+        xSemaphoreTake(s_work, portMAX_DELAY);
+
+        // Devices are declared in priority order
+        for (int dev = 0; dev < I2C_BUS_DEV_COUNT; dev++) {
+            request_t *req = NULL;
+            if (xQueueReceive(s_queues[dev], &req, 0) == pdTRUE) {
+                execute(req);
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Queue a request and wait for it to complete
+ */
+static esp_err_t submit(request_t *req)
+{
+    waiter_init(&req->leader);
+    req->followers = NULL;
+    req->submit_us = esp_timer_get_time();
+
+    if (req->fn == NULL) {
+        taskENTER_CRITICAL(&s_lock);
+        for (int i = 0; i < I2C_BUS_MAX_QUEUED_WRITES; i++) {
+            if (s_queued_writes[i] == NULL) {
+                s_queued_writes[i] = req;
+                break;
+            }
+        }
+        taskEXIT_CRITICAL(&s_lock);
+    }
+
+    xQueueSend(s_queues[req->dev], &req, portMAX_DELAY);
+    xSemaphoreGive(s_work);
+    xSemaphoreTake(req->leader.done, portMAX_DELAY);
+    return req->leader.result;
+}
+
+esp_err_t i2c_bus_start(const i2c_bus_config_t *config)
+{
+    ESP_RETURN_ON_FALSE(config != NULL, ESP_ERR_INVALID_ARG, TAG, "config is NULL");
+    ESP_RETURN_ON_FALSE(s_task == NULL, ESP_ERR_INVALID_STATE, TAG, "Already started");
+
+    s_config = *config;
+    if (s_config.timeout_ms <= 0) {
+        s_config.timeout_ms = 50;
+    }
+
+    s_work = xSemaphoreCreateCounting(I2C_BUS_DEV_COUNT * I2C_BUS_QUEUE_LEN, 0);
+    ESP_RETURN_ON_FALSE(s_work != NULL, ESP_ERR_NO_MEM, TAG, "Failed to create semaphore");
+    for (int dev = 0; dev < I2C_BUS_DEV_COUNT; dev++) {
+        s_queues[dev] = xQueueCreate(I2C_BUS_QUEUE_LEN, sizeof(request_t *));
+        ESP_RETURN_ON_FALSE(s_queues[dev] != NULL, ESP_ERR_NO_MEM, TAG, "Failed to create queue");
+    }
+
+    BaseType_t ret = xTaskCreatePinnedToCore(i2c_bus_task, "i2c_bus", I2C_BUS_TASK_STACK_SIZE,
+                                             NULL, s_config.task_priority, &s_task,
+                                             s_config.core_id);
+    ESP_RETURN_ON_FALSE(ret == pdPASS, ESP_ERR_NO_MEM, TAG, "Failed to create bus task");
+
+    ESP_LOGI(TAG, "I2C bus manager started on port %d (timeout %d ms)",
+             s_config.i2c_port, s_config.timeout_ms);
+    return ESP_OK;
+}
+
+bool i2c_bus_is_running(void)
+{
+    return s_task != NULL;
+}
+
+esp_err_t i2c_bus_write_byte(i2c_bus_dev_t dev, uint8_t addr, uint8_t value)
+{
+    ESP_RETURN_ON_FALSE(dev < I2C_BUS_DEV_COUNT, ESP_ERR_INVALID_ARG, TAG, "Invalid device");
+    ESP_RETURN_ON_FALSE(s_task != NULL, ESP_ERR_INVALID_STATE, TAG, "Bus not started");
+
+    if (xTaskGetCurrentTaskHandle() == s_task) {
+        return write_byte_direct(addr, value);
+    }
+
+    // Merge into a queued write to the same address if there is one
+    waiter_t follower;
+    waiter_init(&follower);
+    bool coalesced = false;
+
+    taskENTER_CRITICAL(&s_lock);
+    for (int i = 0; i < I2C_BUS_MAX_QUEUED_WRITES; i++) {
+        request_t *queued = s_queued_writes[i];
+        if (queued != NULL && queued->addr == addr) {
+            queued->value = value;
+            follower.next = queued->followers;
+            queued->followers = &follower;
+            s_stats[dev].coalesced++;
+            coalesced = true;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (coalesced) {
+        xSemaphoreTake(follower.done, portMAX_DELAY);
+        return follower.result;
+    }
+
+    request_t req = {
+        .dev = dev,
+        .addr = addr,
+        .value = value,
+        .fn = NULL,
+        .ctx = NULL,
+    };
+    return submit(&req);
+}
+
+esp_err_t i2c_bus_call(i2c_bus_dev_t dev, esp_err_t (*fn)(void *ctx), void *ctx)
+{
+    ESP_RETURN_ON_FALSE(dev < I2C_BUS_DEV_COUNT, ESP_ERR_INVALID_ARG, TAG, "Invalid device");
+    ESP_RETURN_ON_FALSE(fn != NULL, ESP_ERR_INVALID_ARG, TAG, "fn is NULL");
+    ESP_RETURN_ON_FALSE(s_task != NULL, ESP_ERR_INVALID_STATE, TAG, "Bus not started");
+
+    if (xTaskGetCurrentTaskHandle() == s_task) {
+        return fn(ctx);
+    }
+
+    request_t req = {
+        .dev = dev,
+        .fn = fn,
+        .ctx = ctx,
+    };
+    return submit(&req);
+}
+
+void i2c_bus_get_stats(i2c_bus_dev_t dev, i2c_bus_stats_t *stats)
+{
+    if (dev >= I2C_BUS_DEV_COUNT || stats == NULL) {
+        return;
+    }
+
+    taskENTER_CRITICAL(&s_lock);
+    *stats = s_stats[dev];
+    taskEXIT_CRITICAL(&s_lock);
+}
+
+const char *i2c_bus_dev_name(i2c_bus_dev_t dev)
+{
+    return dev < I2C_BUS_DEV_COUNT ? s_dev_names[dev] : "?";
+}
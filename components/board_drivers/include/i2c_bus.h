@@ -0,0 +1,115 @@
+/**
+ * @file i2c_bus.h
+ * @brief Shared I2C bus manager for the board drivers
+ *
+ * The CH422G expander and the GT911 touch controller share one I2C port.
+ * Once started, a single owner task performs every transaction on that port:
+ * - Touch transactions are served before expander transactions
+ * - Expander register writes that are still queued are coalesced (the
+ *   latest value wins and all callers get the result of that one write)
+ * - Each transaction is bounded by the configured timeout
+ * - Transactions, errors and timeouts are counted per device
+ *
+ * Before i2c_bus_start() (and in the bootloader, which never starts it),
+ * the drivers talk to the I2C driver directly.
+ */
+
+#pragma once
+
+#include "esp_err.h"
+#include "driver/i2c.h"
+#include "freertos/FreeRTOS.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Devices on the shared bus, in priority order
+ */
+typedef enum {
+    I2C_BUS_DEV_TOUCH,      ///< GT911 (served first)
+    I2C_BUS_DEV_EXPANDER,   ///< CH422G
+    I2C_BUS_DEV_COUNT
+} i2c_bus_dev_t;
+
+/**
+ * @brief Bus manager configuration
+ */
+typedef struct {
+    i2c_port_t i2c_port;        ///< I2C port (driver already installed)
+    int timeout_ms;             ///< Timeout of a single transaction
+    UBaseType_t task_priority;  ///< Owner task priority
+    BaseType_t core_id;         ///< Core to pin the owner task to
+} i2c_bus_config_t;
+
+/**
+ * @brief Per-device statistics
+ */
+typedef struct {
+    uint32_t transactions;      ///< Transactions performed
+    uint32_t errors;            ///< Failed transactions (including timeouts)
+    uint32_t timeouts;          ///< Transactions that hit the timeout
+    uint32_t coalesced;         ///< Writes merged into an already queued write
+    uint32_t max_latency_us;    ///< Longest submit-to-completion time
+    esp_err_t last_error;       ///< Most recent error, ESP_OK if none
+} i2c_bus_stats_t;
+
+/**
+ * @brief Start the bus owner task
+ *
+ * @param config Bus configuration
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if already started
+ */
+esp_err_t i2c_bus_start(const i2c_bus_config_t *config);
+
+/**
+ * @brief Check whether the owner task is running
+ */
+bool i2c_bus_is_running(void);
+
+/**
+ * @brief Write one byte to a device address (blocking)
+ *
+ * For register-per-address devices such as the CH422G. If a write to the
+ * same address is still queued, its value is replaced instead of queuing
+ * another transaction.
+ *
+ * @param dev Device the write is accounted to
+ * @param addr 7-bit I2C address
+ * @param value Byte to write
+ * @return esp_err_t Result of the write that carried the value
+ */
+esp_err_t i2c_bus_write_byte(i2c_bus_dev_t dev, uint8_t addr, uint8_t value);
+
+/**
+ * @brief Run a driver function on the owner task (blocking)
+ *
+ * Used for transactions issued by other drivers, such as esp_lcd_touch
+ * reads. The function must not call back into i2c_bus.
+ *
+ * @param dev Device the transaction is accounted to (sets its priority)
+ * @param fn Function performing the transaction
+ * @param ctx Argument for fn
+ * @return esp_err_t Result of fn
+ */
+esp_err_t i2c_bus_call(i2c_bus_dev_t dev, esp_err_t (*fn)(void *ctx), void *ctx);
+
+/**
+ * @brief Copy a device's statistics
+ *
+ * @param dev Device
+ * @param stats Output: statistics since boot
+ */
+void i2c_bus_get_stats(i2c_bus_dev_t dev, i2c_bus_stats_t *stats);
+
+/**
+ * @brief Get a device's display name (for logs)
+ */
+const char *i2c_bus_dev_name(i2c_bus_dev_t dev);
+
+#ifdef __cplusplus
+}
+#endif
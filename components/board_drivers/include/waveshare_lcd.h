@@ -74,6 +74,18 @@ esp_err_t waveshare_lcd_register_vsync_callback(
     void *user_ctx
 );
 
+/**
+ * @brief Change the pixel clock of a running panel
+ * 
+ * Takes effect at the next VSYNC. A lower clock lowers the refresh rate
+ * and with it the PSRAM read bandwidth and bounce buffer interrupts.
+ * 
+ * @param panel_handle LCD panel handle
+ * @param pclk_hz New pixel clock frequency
+ * @return ESP_OK on success
+ */
+esp_err_t waveshare_lcd_set_pixel_clock(esp_lcd_panel_handle_t panel_handle, uint32_t pclk_hz);
+
 /**
  * @brief Get frame buffer(s) from the LCD panel
  * 
@@ -8,6 +8,9 @@
 #include "esp_err.h"
 #include "esp_lcd_touch.h"
 #include "ch422g.h"
+#include "freertos/FreeRTOS.h"
+#include <stdbool.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -23,6 +26,11 @@ extern "C" {
  */
 #define TOUCH_GPIO4         GPIO_NUM_4
 
+/**
+ * @brief GT911 INT line (same pin; an input once the reset sequence is done)
+ */
+#define TOUCH_INT_GPIO      TOUCH_GPIO4
+
 /**
  * @brief Touch configuration structure
  */
@@ -31,8 +39,32 @@ typedef struct {
     int h_res;                      ///< Horizontal resolution
     int v_res;                      ///< Vertical resolution
     ch422g_handle_t ch422g_handle;  ///< CH422G handle for reset sequence
+    bool use_interrupt;             ///< Use the GT911 INT line (TOUCH_INT_GPIO)
+    int timeout_ms;                 ///< Timeout of a single GT911 transaction (0 = 50 ms)
 } waveshare_touch_config_t;
 
+/**
+ * @brief Latest touch state published by the reader task
+ */
+typedef struct {
+    uint16_t x;                     ///< X of the first point
+    uint16_t y;                     ///< Y of the first point
+    uint8_t count;                  ///< Number of points (0 = released)
+    uint32_t seq;                   ///< Incremented for every new sample
+    int64_t timestamp_us;           ///< esp_timer time of the INT (or poll) that produced it
+} waveshare_touch_sample_t;
+
+/**
+ * @brief Touch reader task configuration
+ */
+typedef struct {
+    UBaseType_t priority;           ///< Reader task priority
+    BaseType_t core_id;             ///< Core to pin the reader task to
+    uint32_t poll_ms;               ///< Read period without INT, or while a touch is held
+    void (*on_sample)(void *ctx);   ///< Called from the reader task when the touch state changes (optional)
+    void *ctx;                      ///< Argument for on_sample
+} waveshare_touch_reader_config_t;
+
 /**
  * @brief Initialize the GT911 touch controller
  * 
@@ -70,6 +102,38 @@ bool waveshare_touch_get_xy(
     uint8_t *num_points
 );
 
+/**
+ * @brief Start the touch reader task
+ * 
+ * The task reads the GT911 when its INT line fires (or every poll_ms when
+ * the controller was initialized without use_interrupt) and publishes the
+ * result for waveshare_touch_get_sample(), so I2C reads never run inside
+ * the LVGL input callback.
+ * 
+ * @param touch_handle Touch controller handle
+ * @param config Reader task configuration
+ * @return ESP_OK on success
+ */
+esp_err_t waveshare_touch_start_reader(esp_lcd_touch_handle_t touch_handle,
+                                       const waveshare_touch_reader_config_t *config);
+
+/**
+ * @brief Change the reader task's poll period
+ * 
+ * Takes effect after the current wait. With INT, this only applies while
+ * a touch is held.
+ * 
+ * @param poll_ms New period in milliseconds (0 is ignored)
+ */
+void waveshare_touch_set_poll_period(uint32_t poll_ms);
+
+/**
+ * @brief Copy the latest touch sample (lock-free, any task)
+ * 
+ * @param sample Output: latest sample (count 0 until the first touch)
+ */
+void waveshare_touch_get_sample(waveshare_touch_sample_t *sample);
+
 #ifdef __cplusplus
 }
 #endif
@@ -105,6 +105,13 @@ esp_err_t waveshare_lcd_register_vsync_callback(
     return esp_lcd_rgb_panel_register_event_callbacks(panel_handle, &cbs, user_ctx);
 }
 
+esp_err_t waveshare_lcd_set_pixel_clock(esp_lcd_panel_handle_t panel_handle, uint32_t pclk_hz)
+{
+    ESP_RETURN_ON_FALSE(panel_handle != NULL, ESP_ERR_INVALID_ARG, TAG, "panel_handle is NULL");
+    ESP_LOGD(TAG, "Pixel clock %lu Hz", (unsigned long)pclk_hz);
+    return esp_lcd_rgb_panel_set_pclk(panel_handle, pclk_hz);
+}
+
 esp_err_t waveshare_lcd_get_frame_buffer(
     esp_lcd_panel_handle_t panel_handle,
     int num_fbs,
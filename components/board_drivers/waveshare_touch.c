@@ -4,19 +4,119 @@
  */
 
 #include "waveshare_touch.h"
+#include "i2c_bus.h"
 #include "esp_lcd_touch_gt911.h"
+#include "esp_lcd_panel_io_interface.h"
 #include "esp_log.h"
 #include "esp_check.h"
 #include "driver/gpio.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
 
 static const char *TAG = "waveshare_touch";
 
+#define TOUCH_READER_STACK_SIZE     3072
+#define TOUCH_IO_MAX_TX             32      ///< Largest GT911 register write (bytes)
+
+// Reader task state
+static bool s_use_interrupt = false;
+static esp_lcd_touch_handle_t s_reader_touch = NULL;
+static TaskHandle_t s_reader_task = NULL;
+static waveshare_touch_reader_config_t s_reader_cfg;
+static volatile int64_t s_int_time_us = 0;   ///< Time of the last INT edge
+
+/**
+ * @brief Latest sample, published under a sequence lock
+ *
+ * The reader task is the only writer: it makes seq odd, writes the sample,
+ * then makes seq even again. Readers retry until they see the same even
+ * seq before and after copying.
+ */
+static struct {
+    atomic_uint seq;
+    waveshare_touch_sample_t sample;
+} s_latest;
+
+/**
+ * @brief GT911 panel IO with bounded transactions
+ *
+ * esp_lcd's I2C panel IO waits for the bus without a timeout, so one stuck
+ * touch transaction could hold the shared bus indefinitely. This IO does the
+ * same 16-bit register reads and writes with the configured timeout.
+ */
+typedef struct {
+    esp_lcd_panel_io_t base;
+    i2c_port_t port;
+    uint8_t addr;
+    TickType_t timeout;
+} touch_io_t;
+
+static esp_err_t touch_io_rx_param(esp_lcd_panel_io_t *io, int lcd_cmd, void *param, size_t param_size)
+{
+    touch_io_t *tio = __containerof(io, touch_io_t, base);
+    uint8_t reg[2] = { (lcd_cmd >> 8) & 0xFF, lcd_cmd & 0xFF };
+    return i2c_master_write_read_device(tio->port, tio->addr, reg, sizeof(reg),
+                                        param, param_size, tio->timeout);
+}
+
+static esp_err_t touch_io_tx_param(esp_lcd_panel_io_t *io, int lcd_cmd, const void *param, size_t param_size)
+{
+    touch_io_t *tio = __containerof(io, touch_io_t, base);
+    ESP_RETURN_ON_FALSE(param_size <= TOUCH_IO_MAX_TX, ESP_ERR_INVALID_SIZE, TAG, "Write too large");
+
+    uint8_t buf[2 + TOUCH_IO_MAX_TX];
+    buf[0] = (lcd_cmd >> 8) & 0xFF;
+    buf[1] = lcd_cmd & 0xFF;
+    if (param_size > 0) {
+        memcpy(&buf[2], param, param_size);
+    }
+    return i2c_master_write_to_device(tio->port, tio->addr, buf, 2 + param_size, tio->timeout);
+}
+
+static esp_err_t touch_io_tx_color(esp_lcd_panel_io_t *io, int lcd_cmd, const void *color, size_t color_size)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+static esp_err_t touch_io_register_event_callbacks(esp_lcd_panel_io_t *io,
+                                                   const esp_lcd_panel_io_callbacks_t *cbs,
+                                                   void *user_ctx)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+static esp_err_t touch_io_del(esp_lcd_panel_io_t *io)
+{
+    free(__containerof(io, touch_io_t, base));
+    return ESP_OK;
+}
+
+static esp_err_t touch_io_new(i2c_port_t port, uint8_t addr, int timeout_ms,
+                              esp_lcd_panel_io_handle_t *ret_io)
+{
+    touch_io_t *tio = calloc(1, sizeof(touch_io_t));
+    ESP_RETURN_ON_FALSE(tio != NULL, ESP_ERR_NO_MEM, TAG, "Failed to allocate touch IO");
+
+    tio->port = port;
+    tio->addr = addr;
+    tio->timeout = pdMS_TO_TICKS(timeout_ms > 0 ? timeout_ms : 50);
+    tio->base.rx_param = touch_io_rx_param;
+    tio->base.tx_param = touch_io_tx_param;
+    tio->base.tx_color = touch_io_tx_color;
+    tio->base.del = touch_io_del;
+    tio->base.register_event_callbacks = touch_io_register_event_callbacks;
+    *ret_io = &tio->base;
+    return ESP_OK;
+}
+
 /**
  * @brief Execute the specific reset sequence for Waveshare board
  */
-static esp_err_t touch_reset_sequence(ch422g_handle_t ch422g, i2c_port_t i2c_port)
+static esp_err_t touch_reset_sequence(ch422g_handle_t ch422g)
 {
     ESP_LOGI(TAG, "Executing touch reset sequence");
 
@@ -33,10 +133,9 @@ static esp_err_t touch_reset_sequence(ch422g_handle_t ch422g, i2c_port_t i2c_por
     // Set CH422G to output mode
     ESP_RETURN_ON_ERROR(ch422g_set_output_mode(ch422g), TAG, "Failed to set CH422G output mode");
 
-    // Assert touch reset via CH422G
-    uint8_t write_buf = 0x2C;
+    // Assert touch reset via CH422G (through the driver so its output cache stays in sync)
     ESP_RETURN_ON_ERROR(
-        i2c_master_write_to_device(i2c_port, CH422G_OUTPUT_ADDR, &write_buf, 1, pdMS_TO_TICKS(1000)),
+        ch422g_write_output(ch422g, CH422G_TOUCH_RST_START),
         TAG, "Failed to assert touch reset"
     );
     
@@ -48,9 +147,8 @@ static esp_err_t touch_reset_sequence(ch422g_handle_t ch422g, i2c_port_t i2c_por
     vTaskDelay(pdMS_TO_TICKS(100));
 
     // Release touch reset
-    write_buf = 0x2E;
     ESP_RETURN_ON_ERROR(
-        i2c_master_write_to_device(i2c_port, CH422G_OUTPUT_ADDR, &write_buf, 1, pdMS_TO_TICKS(1000)),
+        ch422g_write_output(ch422g, CH422G_TOUCH_RST_END),
         TAG, "Failed to release touch reset"
     );
     
@@ -70,16 +168,16 @@ esp_err_t waveshare_touch_init(const waveshare_touch_config_t *config, esp_lcd_t
 
     // Execute reset sequence
     ESP_RETURN_ON_ERROR(
-        touch_reset_sequence(config->ch422g_handle, config->i2c_port),
+        touch_reset_sequence(config->ch422g_handle),
         TAG, "Touch reset sequence failed"
     );
 
-    // Create I2C panel IO handle for touch controller
+    // Create I2C panel IO handle for touch controller (bounded by timeout_ms)
     esp_lcd_panel_io_handle_t tp_io_handle = NULL;
     esp_lcd_panel_io_i2c_config_t tp_io_config = ESP_LCD_TOUCH_IO_I2C_GT911_CONFIG();
 
     ESP_RETURN_ON_ERROR(
-        esp_lcd_new_panel_io_i2c((esp_lcd_i2c_bus_handle_t)config->i2c_port, &tp_io_config, &tp_io_handle),
+        touch_io_new(config->i2c_port, tp_io_config.dev_addr, config->timeout_ms, &tp_io_handle),
         TAG, "Failed to create I2C panel IO"
     );
 
@@ -88,10 +186,11 @@ esp_err_t waveshare_touch_init(const waveshare_touch_config_t *config, esp_lcd_t
         .x_max = config->h_res,
         .y_max = config->v_res,
         .rst_gpio_num = -1,     // Reset handled via CH422G
-        .int_gpio_num = -1,     // Interrupt not used (polling)
+        // The address is latched, so GPIO4 can become the INT input now
+        .int_gpio_num = config->use_interrupt ? TOUCH_INT_GPIO : -1,
         .levels = {
             .reset = 0,
-            .interrupt = 0,
+            .interrupt = 0,     // GT911 default: falling edge
         },
         .flags = {
             .swap_xy = 0,
@@ -105,7 +204,9 @@ esp_err_t waveshare_touch_init(const waveshare_touch_config_t *config, esp_lcd_t
         TAG, "Failed to create GT911 touch controller"
     );
 
-    ESP_LOGI(TAG, "GT911 touch controller initialized (%dx%d)", config->h_res, config->v_res);
+    s_use_interrupt = config->use_interrupt;
+    ESP_LOGI(TAG, "GT911 touch controller initialized (%dx%d, %s)", config->h_res, config->v_res,
+             s_use_interrupt ? "interrupt" : "polling");
     return ESP_OK;
 }
 
@@ -129,3 +230,131 @@ bool waveshare_touch_get_xy(
 
     return esp_lcd_touch_get_coordinates(touch_handle, x, y, strength, num_points, max_points);
 }
+
+/**
+ * @brief GT911 INT handler - wakes the reader task
+ */
+static void IRAM_ATTR touch_isr_cb(esp_lcd_touch_handle_t tp)
+{
+    BaseType_t need_yield = pdFALSE;
+    s_int_time_us = esp_timer_get_time();
+    vTaskNotifyGiveFromISR(s_reader_task, &need_yield);
+    if (need_yield == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static esp_err_t touch_read_data(void *ctx)
+{
+    return esp_lcd_touch_read_data((esp_lcd_touch_handle_t)ctx);
+}
+
+/**
+ * @brief Publish a new sample (reader task only)
+ */
+static void publish_sample(const waveshare_touch_sample_t *sample)
+{
+    unsigned seq = atomic_load_explicit(&s_latest.seq, memory_order_relaxed);
+    atomic_store_explicit(&s_latest.seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    s_latest.sample = *sample;
+    atomic_store_explicit(&s_latest.seq, seq + 2, memory_order_release);
+}
+
+/**
+ * @brief Read the GT911 on INT (or periodically) and publish changes
+ */
+static void touch_reader_task(void *arg)
+{
+    waveshare_touch_sample_t sample = {0};
+
+    while (1) {
+        TickType_t poll_ticks = pdMS_TO_TICKS(s_reader_cfg.poll_ms);
+        // With INT, only poll while a touch is held so a missed release edge
+        // cannot leave the point stuck
+        TickType_t wait = (!s_use_interrupt || sample.count > 0) ? poll_ticks : portMAX_DELAY;
+        bool interrupted = ulTaskNotifyTake(pdTRUE, wait) > 0;
+        int64_t timestamp_us = interrupted ? s_int_time_us : esp_timer_get_time();
+
+        // Through the bus manager when running, so touch reads go before expander writes
+        esp_err_t ret = i2c_bus_is_running() ?
+                        i2c_bus_call(I2C_BUS_DEV_TOUCH, touch_read_data, s_reader_touch) :
+                        touch_read_data(s_reader_touch);
+        if (ret != ESP_OK) {
+            ESP_LOGD(TAG, "Touch read failed");
+            continue;
+        }
+
+        esp_lcd_touch_point_data_t point;
+        uint8_t count = 0;
+        if (esp_lcd_touch_get_data(s_reader_touch, &point, &count, 1) != ESP_OK) {
+            count = 0;
+        }
+
+        bool changed = count != sample.count ||
+                       (count > 0 && (point.x != sample.x || point.y != sample.y));
+        if (!changed) {
+            continue;
+        }
+
+        if (count > 0) {
+            sample.x = point.x;
+            sample.y = point.y;
+        }
+        sample.count = count;
+        sample.seq++;
+        sample.timestamp_us = timestamp_us;
+        publish_sample(&sample);
+
+        if (s_reader_cfg.on_sample) {
+            s_reader_cfg.on_sample(s_reader_cfg.ctx);
+        }
+    }
+}
+
+esp_err_t waveshare_touch_start_reader(esp_lcd_touch_handle_t touch_handle,
+                                       const waveshare_touch_reader_config_t *config)
+{
+    ESP_RETURN_ON_FALSE(touch_handle != NULL, ESP_ERR_INVALID_ARG, TAG, "touch_handle is NULL");
+    ESP_RETURN_ON_FALSE(config != NULL, ESP_ERR_INVALID_ARG, TAG, "config is NULL");
+    ESP_RETURN_ON_FALSE(config->poll_ms > 0, ESP_ERR_INVALID_ARG, TAG, "poll_ms is 0");
+    ESP_RETURN_ON_FALSE(s_reader_task == NULL, ESP_ERR_INVALID_STATE, TAG, "Reader already running");
+
+    s_reader_touch = touch_handle;
+    s_reader_cfg = *config;
+
+    BaseType_t ret = xTaskCreatePinnedToCore(touch_reader_task, "touch_reader",
+                                             TOUCH_READER_STACK_SIZE, NULL,
+                                             config->priority, &s_reader_task, config->core_id);
+    ESP_RETURN_ON_FALSE(ret == pdPASS, ESP_ERR_NO_MEM, TAG, "Failed to create touch reader task");
+
+    if (s_use_interrupt) {
+        ESP_RETURN_ON_ERROR(
+            esp_lcd_touch_register_interrupt_callback(touch_handle, touch_isr_cb),
+            TAG, "Failed to register touch interrupt"
+        );
+    }
+
+    ESP_LOGI(TAG, "Touch reader started (%s, %lu ms)",
+             s_use_interrupt ? "interrupt" : "polling", (unsigned long)config->poll_ms);
+    return ESP_OK;
+}
+
+void waveshare_touch_set_poll_period(uint32_t poll_ms)
+{
+    if (poll_ms > 0) {
+        s_reader_cfg.poll_ms = poll_ms;
+    }
+}
+
+void waveshare_touch_get_sample(waveshare_touch_sample_t *sample)
+{
+    unsigned before;
+    unsigned after;
+    do {
+        before = atomic_load_explicit(&s_latest.seq, memory_order_acquire);
+        *sample = s_latest.sample;
+        atomic_thread_fence(memory_order_acquire);
+        after = atomic_load_explicit(&s_latest.seq, memory_order_relaxed);
+    } while ((before & 1) != 0 || before != after);
+}
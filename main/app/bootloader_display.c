@@ -397,7 +397,7 @@ esp_err_t bootloader_display_init(void)
     // 2. Initialize CH422G (needed for backlight)
     ch422g_config_t ch422g_config = {
         .i2c_port = I2C_NUM_0,
-        .timeout_ms = 1000,
+        .timeout_ms = CONFIG_I2C_TRANSACTION_TIMEOUT_MS,
     };
     ret = ch422g_init(&ch422g_config, &s_ch422g);
     if (ret != ESP_OK) {
@@ -11,6 +11,7 @@
 
 #include "fade_controller.h"
 #include "lcc_node.h"
+#include "ui/ui_common.h"
 
 #include <string.h>
 #include <math.h>
@@ -24,6 +25,9 @@ static const char *TAG = "fade_ctrl";
 /// Maximum duration that can be sent in a single command (255 seconds)
 #define MAX_SEGMENT_DURATION_SEC  255
 
+/// published_percent before the first progress of a fade is sent
+#define PERCENT_NONE  0xFF
+
 /**
  * @brief Internal fade state
  */
@@ -51,6 +55,9 @@ typedef struct {
     // Tracking what LED controllers are currently showing (for segment starts)
     lighting_state_t current;           // Current/last sent values
     
+    // Progress bar notifications
+    uint8_t published_percent;          // Last percent sent to the UI
+    
 } fade_state_internal_t;
 
 static fade_state_internal_t s_fade = {0};
@@ -71,6 +78,22 @@ static void interpolate_state(const lighting_state_t *start, const lighting_stat
     result->brightness = start->brightness + (int16_t)(end->brightness - start->brightness) * progress;
 }
 
+/**
+ * @brief Whole percent of the total fade duration elapsed at now_us (FADING only)
+ */
+static uint8_t fade_percent(int64_t now_us)
+{
+    if (s_fade.total_duration_ms == 0) {
+        return 100;
+    }
+    
+    uint64_t elapsed_ms = (uint64_t)(now_us - s_fade.fade_start_us) / 1000;
+    if (elapsed_ms >= s_fade.total_duration_ms) {
+        return 100;
+    }
+    return (uint8_t)(elapsed_ms * 100 / s_fade.total_duration_ms);
+}
+
 /**
  * @brief Send all 6 LCC events (RGBW + Brightness + Duration)
  */
@@ -186,6 +209,7 @@ esp_err_t fade_controller_start(const fade_params_t *params)
     
     s_fade.current_segment = -1;  // Will be incremented to 0 in start_next_segment
     s_fade.fade_start_us = esp_timer_get_time();
+    s_fade.published_percent = PERCENT_NONE;
     s_fade.state = FADE_STATE_FADING;
     
     ESP_LOGD(TAG, "Starting fade: %lums (%d segment%s) to R=%d G=%d B=%d W=%d Br=%d",
@@ -234,11 +258,19 @@ esp_err_t fade_controller_tick(void)
     if (s_fade.state == FADE_STATE_COMPLETE) {
         // Transition to idle
         s_fade.state = FADE_STATE_IDLE;
+        ui_scenes_notify_fade_progress(100, true);
         return ESP_OK;
     }
     
-    // FADING state - check if current segment is complete
+    // FADING state - publish progress when the whole percent changes
     int64_t now_us = esp_timer_get_time();
+    uint8_t percent = fade_percent(now_us);
+    if (percent != s_fade.published_percent) {
+        s_fade.published_percent = percent;
+        ui_scenes_notify_fade_progress(percent, false);
+    }
+    
+    // Check if current segment is complete
     int64_t segment_elapsed_us = now_us - s_fade.segment_start_us;
     uint32_t segment_elapsed_ms = (uint32_t)(segment_elapsed_us / 1000);
     
@@ -276,20 +308,13 @@ fade_state_t fade_controller_get_progress(fade_progress_t *progress)
         progress->total_ms = s_fade.total_duration_ms;
         
         if (s_fade.state == FADE_STATE_FADING) {
-            int64_t elapsed_us = esp_timer_get_time() - s_fade.fade_start_us;
+            int64_t now_us = esp_timer_get_time();
+            int64_t elapsed_us = now_us - s_fade.fade_start_us;
             progress->elapsed_ms = (uint32_t)(elapsed_us / 1000);
             if (progress->elapsed_ms > progress->total_ms) {
                 progress->elapsed_ms = progress->total_ms;
             }
-            
-            if (progress->total_ms > 0) {
-                progress->progress_percent = (uint8_t)((progress->elapsed_ms * 100) / progress->total_ms);
-                if (progress->progress_percent > 100) {
-                    progress->progress_percent = 100;
-                }
-            } else {
-                progress->progress_percent = 100;
-            }
+            progress->progress_percent = fade_percent(now_us);
         } else if (s_fade.state == FADE_STATE_COMPLETE) {
             progress->elapsed_ms = progress->total_ms;
             progress->progress_percent = 100;
@@ -319,6 +344,9 @@ void fade_controller_abort(void)
         // (They'll calculate their own current position based on elapsed time)
     }
     
+    if (s_fade.state != FADE_STATE_IDLE) {
+        ui_scenes_notify_fade_progress(100, true);
+    }
     s_fade.state = FADE_STATE_IDLE;
 }
 
@@ -109,7 +109,8 @@ esp_err_t fade_controller_apply_immediate(const lighting_state_t *state);
  * @brief Process fade controller tick
  * 
  * Must be called periodically (recommended: every 100ms) to:
- * - Track elapsed time for progress bar display
+ * - Publish progress to the UI when the whole percent changes, and once
+ *   when the fade ends (ui_scenes_notify_fade_progress())
  * - Send next segment commands for long fades (>255 seconds)
  * - Transition to COMPLETE state when fade finishes
  * 
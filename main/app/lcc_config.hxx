@@ -77,6 +77,28 @@ CDI_GROUP_ENTRY(base_event_id, EventConfigEntry,
 
 CDI_GROUP_END();
 
+/// CDI segment for diagnostics
+CDI_GROUP(DiagnosticsConfig);
+
+/// UI profiling overlay and log
+CDI_GROUP_ENTRY(profiling_enabled, Uint8ConfigEntry,
+    Name("UI Profiling Overlay"),
+    Description("When enabled (1), shows frame time, flush time and dirty-area "
+                "statistics on screen and logs them every second. Takes effect "
+                "immediately. Default: 0 (off)."),
+    Default(0),
+    Min(0),
+    Max(1));
+
+/// LVGL allocator usage (read-only, served from memory on every read)
+CDI_GROUP_ENTRY(lvgl_memory, StringConfigEntry<96>,
+    Name("LVGL Memory (read-only)"),
+    Description("Internal pool and PSRAM used by LVGL, with peaks, pool "
+                "fragmentation and pool overflows since boot. Refreshed on "
+                "every read; writes are ignored."));
+
+CDI_GROUP_END();
+
 /// Main CDI segment containing all user-configurable options
 /// Laid out at origin 128 to give space for the ACDI user data at the beginning.
 CDI_GROUP(LccConfigSegment, Segment(MemoryConfigDefs::SPACE_CONFIG), Offset(128));
@@ -90,6 +112,9 @@ CDI_GROUP_ENTRY(startup, StartupConfig, Name("Startup Behavior"));
 /// Lighting configuration
 CDI_GROUP_ENTRY(lighting, LightingConfig, Name("Lighting Configuration"));
 
+/// Diagnostics
+CDI_GROUP_ENTRY(diagnostics, DiagnosticsConfig, Name("Diagnostics"));
+
 CDI_GROUP_END();
 
 /// The complete CDI definition for this node
@@ -13,10 +13,17 @@
 #include "lcc_node.h"
 #include "lcc_config.hxx"
 #include "bootloader_hal.h"
+#include "scene_storage.h"
+#include "scene_bin.h"
+#include "ui_mem.h"
+#include "ui_perf.h"
+#include "screen_timeout.h"
 
 #include <cstdio>
 #include <cstring>
 #include <cstdlib>
+#include <algorithm>
+#include <atomic>
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/stat.h>
@@ -25,11 +32,13 @@
 #include "freertos/task.h"
 #include "esp_log.h"
 #include "esp_vfs.h"
+#include "esp_heap_caps.h"
 
 #include "openlcb/SimpleStack.hxx"
 #include "openlcb/SimpleNodeInfoDefs.hxx"
 #include "openlcb/ConfiguredProducer.hxx"
 #include "openlcb/ConfigUpdateFlow.hxx"
+#include "executor/Timer.hxx"
 #include "utils/ConfigUpdateListener.hxx"
 // AutoSyncFileFlow no longer needed - we fsync after every write in LoggingFileMemorySpace
 #include "freertos_drivers/esp32/Esp32HardwareTwai.hxx"
@@ -66,6 +75,9 @@ static uint16_t s_auto_apply_duration_sec = openlcb::DEFAULT_AUTO_APPLY_DURATION
 /// Cached screen timeout in seconds
 static uint16_t s_screen_timeout_sec = openlcb::DEFAULT_SCREEN_TIMEOUT_SEC;
 
+/// UI profiling overlay (pushed to ui_perf when the configuration is applied)
+static volatile bool s_profiling_enabled = false;
+
 /// Config file path
 static std::string s_config_path;
 
@@ -190,6 +202,10 @@ static void create_default_nodeid_file(const char *path)
  * ESP-IDF's FAT VFS caches file data, which can cause reads to return stale
  * data after writes unless fsync() is called. This class wraps the standard
  * file operations and calls fsync() after every write to ensure consistency.
+ * 
+ * An optional status field is served from memory instead of the file: reads
+ * of its range are filled by a callback, so live values appear in the CDI
+ * without writing the SD card.
  */
 class SyncingFileMemorySpace : public openlcb::MemorySpace
 {
@@ -203,6 +219,15 @@ public:
     
     openlcb::MemorySpace::address_t max_address() override { return fileSize_; }
 
+    /// Serve [offset, offset + size) from fill() instead of the file
+    void set_status_field(openlcb::MemorySpace::address_t offset, size_t size,
+                          int (*fill)(char *buf, size_t size))
+    {
+        statusOffset_ = offset;
+        statusSize_ = size;
+        statusFill_ = fill;
+    }
+
     size_t write(openlcb::MemorySpace::address_t destination, const uint8_t *data,
                  size_t len, errorcode_t *error, Notifiable *again) override
     {
@@ -254,12 +279,37 @@ public:
             return 0;
         }
         
-        return ret;
+        return overlay_status(destination, dst, len, ret);
     }
 
 private:
+    /// Replace the part of a read that falls in the status field
+    size_t overlay_status(openlcb::MemorySpace::address_t destination, uint8_t *dst,
+                          size_t len, size_t ret)
+    {
+        if (statusFill_ == nullptr || destination + len <= statusOffset_ ||
+            destination >= statusOffset_ + statusSize_) {
+            return ret;
+        }
+
+        char status[128] = {0};
+        statusFill_(status, statusSize_ < sizeof(status) ? statusSize_ : sizeof(status));
+
+        openlcb::MemorySpace::address_t start = std::max(destination, statusOffset_);
+        openlcb::MemorySpace::address_t end = std::min<openlcb::MemorySpace::address_t>(
+            destination + len, statusOffset_ + statusSize_);
+        for (openlcb::MemorySpace::address_t a = start; a < end; a++) {
+            size_t i = a - statusOffset_;
+            dst[a - destination] = i < sizeof(status) ? (uint8_t)status[i] : 0;
+        }
+        return std::max<size_t>(ret, end - destination);
+    }
+
     int fd_;
     openlcb::MemorySpace::address_t fileSize_;
+    openlcb::MemorySpace::address_t statusOffset_ = 0;
+    size_t statusSize_ = 0;
+    int (*statusFill_)(char *buf, size_t size) = nullptr;
 };
 
 /// Custom memory space for config (space 253) that syncs after writes
@@ -268,6 +318,262 @@ static SyncingFileMemorySpace* s_config_space = nullptr;
 /// Custom memory space for ACDI user (space 251) that syncs after writes  
 static SyncingFileMemorySpace* s_acdi_usr_space = nullptr;
 
+/**
+ * @brief Memory space exposing the scene library as a scenes.bin image
+ * 
+ * Reads return a snapshot of the default category, taken when address 0 is
+ * read and freed once its last byte has been read. Writes must start at
+ * address 0 and proceed in order (repeats of already written addresses are
+ * allowed for retries). Once the header and all header.count records have
+ * arrived, the image is imported through scene_storage_import_bin(), which
+ * rejects it unless the CRC matches. An unfinished upload is dropped when
+ * a read starts or after STAGING_IDLE_SEC without a write.
+ * 
+ * The SD card import and the export snapshot run as ui_async_call() jobs in
+ * LVGL context, which serializes them with edits made on screen. Meanwhile
+ * the OpenMRN executor keeps handling LCC traffic: the request returns
+ * MemorySpace::ERROR_AGAIN and is retried once the job notifies `again`.
+ */
+class SceneMemorySpace : public openlcb::MemorySpace
+{
+public:
+    /// @param executor Executor running the memory config handler
+    explicit SceneMemorySpace(ExecutorBase *executor)
+        : idleTimer_(this, executor->active_timers())
+    {
+    }
+
+    bool read_only() override { return false; }
+    
+    openlcb::MemorySpace::address_t max_address() override
+    {
+        return IMAGE_MAX_SIZE - 1;
+    }
+
+    size_t write(openlcb::MemorySpace::address_t destination, const uint8_t *data,
+                 size_t len, errorcode_t *error, Notifiable *again) override
+    {
+        if (job_ == JOB_IMPORT) {
+            // Retry of the write that completed the upload
+            if (!job_finished(error, again)) {
+                return 0;
+            }
+            release(&staging_, &staged_);
+            if (jobResult_ != ESP_OK) {
+                ESP_LOGE(TAG, "Scene upload rejected: %s", esp_err_to_name(jobResult_));
+                *error = openlcb::Defs::ERROR_PERMANENT;
+                return 0;
+            }
+            return len;
+        }
+        if (job_ != JOB_NONE) {
+            *error = openlcb::Defs::ERROR_TEMPORARY;  // An export is running
+            return 0;
+        }
+        
+        if (destination == 0) {
+            // New upload; any snapshot for reads is now out of date
+            release(&snapshot_, &snapshotSize_);
+            staged_ = 0;
+            expected_ = 0;
+            if (!staging_) {
+                staging_ = (uint8_t *)heap_caps_malloc(IMAGE_MAX_SIZE,
+                                                       MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+            }
+        }
+        
+        if (!staging_) {
+            *error = openlcb::Defs::ERROR_PERMANENT;
+            return 0;
+        }
+        lastWriteNsec_ = os_get_time_monotonic();
+        if (!idleTimerRunning_) {
+            idleTimerRunning_ = true;
+            idleTimer_.start(SEC_TO_NSEC(STAGING_IDLE_SEC));
+        }
+        
+        if (destination > staged_ || destination + len > IMAGE_MAX_SIZE) {
+            *error = openlcb::MemoryConfigDefs::ERROR_OUT_OF_BOUNDS;
+            return 0;
+        }
+        
+        memcpy(staging_ + destination, data, len);
+        if (destination + len > staged_) {
+            staged_ = destination + len;
+        }
+        
+        if (expected_ == 0 && staged_ >= sizeof(scene_bin_header_t)) {
+            uint32_t count = ((const scene_bin_header_t *)staging_)->count;
+            if (count > SCENE_STORAGE_MAX_SCENES) {
+                ESP_LOGE(TAG, "Scene upload: %u scenes exceeds limit", (unsigned)count);
+                release(&staging_, &staged_);
+                *error = openlcb::MemoryConfigDefs::ERROR_OUT_OF_BOUNDS;
+                return 0;
+            }
+            expected_ = sizeof(scene_bin_header_t) + count * sizeof(scene_bin_record_t);
+        }
+        
+        if (expected_ != 0 && staged_ >= expected_) {
+            // Complete: import in LVGL context, this write is retried when done
+            start_job(JOB_IMPORT, error, again);
+            return 0;
+        }
+        
+        return len;
+    }
+
+    size_t read(openlcb::MemorySpace::address_t destination, uint8_t *dst,
+                size_t len, errorcode_t *error, Notifiable *again) override
+    {
+        if (job_ == JOB_EXPORT) {
+            // Retry of the read that requested the snapshot
+            if (!job_finished(error, again)) {
+                return 0;
+            }
+            if (jobResult_ != ESP_OK) {
+                *error = openlcb::Defs::ERROR_PERMANENT;
+                return 0;
+            }
+        } else if (job_ != JOB_NONE) {
+            *error = openlcb::Defs::ERROR_TEMPORARY;  // An import is running
+            return 0;
+        } else if (destination == 0 || !snapshot_) {
+            // A read ends any unfinished upload
+            release(&staging_, &staged_);
+            release(&snapshot_, &snapshotSize_);
+            start_job(JOB_EXPORT, error, again);
+            return 0;
+        }
+        
+        if (destination >= snapshotSize_) {
+            *error = openlcb::MemoryConfigDefs::ERROR_OUT_OF_BOUNDS;
+            return 0;
+        }
+        
+        if (len > snapshotSize_ - destination) {
+            len = snapshotSize_ - destination;
+        }
+        memcpy(dst, snapshot_ + destination, len);
+        if (destination + len == snapshotSize_) {
+            // Last byte served; a re-read takes a new snapshot
+            release(&snapshot_, &snapshotSize_);
+        }
+        return len;
+    }
+
+private:
+    static constexpr size_t IMAGE_MAX_SIZE = sizeof(scene_bin_header_t) +
+        SCENE_STORAGE_MAX_SCENES * sizeof(scene_bin_record_t);
+
+    /// An upload with no write for this long is dropped
+    static constexpr unsigned STAGING_IDLE_SEC = 30;
+
+    /// Checks an upload for inactivity (executor thread, like read and write)
+    class IdleTimer : public ::Timer
+    {
+    public:
+        IdleTimer(SceneMemorySpace *parent, ActiveTimers *timers)
+            : ::Timer(timers), parent_(parent)
+        {
+        }
+
+        long long timeout() override
+        {
+            return parent_->staging_idle_check();
+        }
+
+    private:
+        SceneMemorySpace *parent_;
+    };
+
+    /// Frees an idle upload; keeps the timer running while one is in progress
+    long long staging_idle_check()
+    {
+        if (staging_ && job_ != JOB_IMPORT &&
+            os_get_time_monotonic() - lastWriteNsec_ >= SEC_TO_NSEC(STAGING_IDLE_SEC)) {
+            ESP_LOGW(TAG, "Scene upload idle, dropped after %u of %u bytes",
+                     (unsigned)staged_, (unsigned)expected_);
+            release(&staging_, &staged_);
+        }
+        if (staging_) {
+            return ::Timer::RESTART;
+        }
+        idleTimerRunning_ = false;
+        return ::Timer::NONE;
+    }
+
+    /// Scene storage work handed to LVGL context
+    enum job_t : uint8_t { JOB_NONE, JOB_IMPORT, JOB_EXPORT };
+
+    /// Queue a job; the caller returns ERROR_AGAIN and is retried when it ends
+    void start_job(job_t job, errorcode_t *error, Notifiable *again)
+    {
+        job_ = job;
+        jobDone_ = false;
+        again_ = again;
+        if (!ui_async_call(job_async_cb, this)) {
+            job_ = JOB_NONE;
+            *error = openlcb::Defs::ERROR_TEMPORARY;
+            return;
+        }
+        *error = openlcb::MemorySpace::ERROR_AGAIN;
+    }
+
+    /// On a retry: true once the job has ended (job_ is cleared), else wait again
+    bool job_finished(errorcode_t *error, Notifiable *again)
+    {
+        if (!jobDone_) {
+            again_ = again;
+            *error = openlcb::MemorySpace::ERROR_AGAIN;
+            return false;
+        }
+        job_ = JOB_NONE;
+        return true;
+    }
+
+    /// Runs the job in LVGL context (ui_lock() held), then resumes the executor
+    static void job_async_cb(void *arg)
+    {
+        SceneMemorySpace *self = static_cast<SceneMemorySpace *>(arg);
+        if (self->job_ == JOB_IMPORT) {
+            self->jobResult_ = scene_storage_import_bin(self->staging_, self->expected_);
+            if (self->jobResult_ == ESP_OK) {
+                scene_storage_reload_ui_no_lock();
+            }
+        } else {
+            self->jobResult_ = scene_storage_export_bin(&self->snapshot_, &self->snapshotSize_);
+        }
+        Notifiable *again = self->again_;
+        self->jobDone_ = true;
+        if (again) {
+            again->notify();
+        }
+    }
+
+    static void release(uint8_t **buf, size_t *size)
+    {
+        heap_caps_free(*buf);
+        *buf = nullptr;
+        *size = 0;
+    }
+
+    uint8_t *snapshot_ = nullptr;   ///< Export image served to reads
+    size_t snapshotSize_ = 0;
+    uint8_t *staging_ = nullptr;    ///< Upload being received
+    size_t staged_ = 0;             ///< Bytes received so far
+    size_t expected_ = 0;           ///< Full upload size, once the header is in
+    long long lastWriteNsec_ = 0;   ///< Time of the last upload write
+    IdleTimer idleTimer_;           ///< Drops an abandoned upload
+    bool idleTimerRunning_ = false;
+    job_t job_ = JOB_NONE;          ///< Job in flight or awaiting its retry (executor)
+    std::atomic<bool> jobDone_{false};
+    esp_err_t jobResult_ = ESP_OK;
+    Notifiable *again_ = nullptr;   ///< Resumed when the job ends
+};
+
+/// Scene library memory space (LCC_SCENE_MEMORY_SPACE)
+static SceneMemorySpace* s_scene_space = nullptr;
+
 /**
  * @brief Configuration update listener
  * 
@@ -297,6 +603,13 @@ public:
         s_auto_apply_duration_sec = s_cfg->seg().startup().auto_apply_duration_sec().read(fd);
         s_screen_timeout_sec = s_cfg->seg().startup().screen_timeout_sec().read(fd);
         
+        // Read diagnostics configuration (only 1 enables, so unwritten 0xFF reads as off)
+        s_profiling_enabled = s_cfg->seg().diagnostics().profiling_enabled().read(fd) == 1;
+        
+        // Both are lock-free; the screen timeout ignores this until it is initialized
+        ui_perf_set_enabled(s_profiling_enabled);
+        screen_timeout_set_duration(s_screen_timeout_sec);
+        
         if (initial_load) {
             ESP_LOGI(TAG, "Startup config: auto_apply=%s, duration=%u sec, screen_timeout=%u sec",
                      s_auto_apply_enabled ? "enabled" : "disabled",
@@ -323,6 +636,12 @@ public:
         s_auto_apply_duration_sec = openlcb::DEFAULT_AUTO_APPLY_DURATION_SEC;
         s_screen_timeout_sec = openlcb::DEFAULT_SCREEN_TIMEOUT_SEC;
         
+        // Diagnostics off by default
+        s_cfg->seg().diagnostics().profiling_enabled().write(fd, 0);
+        s_profiling_enabled = false;
+        ui_perf_set_enabled(false);
+        screen_timeout_set_duration(s_screen_timeout_sec);
+        
         // Set default base event ID
         s_cfg->seg().lighting().base_event_id().write(fd, openlcb::DEFAULT_BASE_EVENT_ID);
         s_base_event_id = openlcb::DEFAULT_BASE_EVENT_ID;
@@ -413,6 +732,20 @@ const char CDI_DATA[] =
       <description>Base event ID for lighting commands. The last two bytes encode parameter type and value. Default: 05.01.01.01.22.60.00.00</description>
     </eventid>
   </group>
+  <group>
+    <name>Diagnostics</name>
+    <int size="1">
+      <name>UI Profiling Overlay</name>
+      <description>When enabled (1), shows frame time, flush time and dirty-area statistics on screen and logs them every second. Takes effect immediately. Default: 0 (off).</description>
+      <min>0</min>
+      <max>1</max>
+      <default>0</default>
+    </int>
+    <string size="96">
+      <name>LVGL Memory (read-only)</name>
+      <description>Internal pool and PSRAM used by LVGL, with peaks, pool fragmentation and pool overflows since boot. Refreshed on every read; writes are ignored.</description>
+    </string>
+  </group>
 </segment>
 </cdi>)xmldata";
 
@@ -523,6 +856,9 @@ esp_err_t lcc_node_init(const lcc_config_t *config)
     
     // Space 253 (SPACE_CONFIG) - main configuration space
     s_config_space = new SyncingFileMemorySpace(config_fd, openlcb::CONFIG_FILE_SIZE);
+    s_config_space->set_status_field(s_cfg->seg().diagnostics().lvgl_memory().offset(),
+                                     s_cfg->seg().diagnostics().lvgl_memory().size(),
+                                     ui_mem_format_stats);
     s_stack->memory_config_handler()->registry()->insert(
         s_stack->node(), openlcb::MemoryConfigDefs::SPACE_CONFIG, s_config_space);
     
@@ -530,6 +866,11 @@ esp_err_t lcc_node_init(const lcc_config_t *config)
     s_acdi_usr_space = new SyncingFileMemorySpace(config_fd, 128);
     s_stack->memory_config_handler()->registry()->insert(
         s_stack->node(), openlcb::MemoryConfigDefs::SPACE_ACDI_USR, s_acdi_usr_space);
+    
+    // Scene library import/export as a scenes.bin image
+    s_scene_space = new SceneMemorySpace(s_stack->executor());
+    s_stack->memory_config_handler()->registry()->insert(
+        s_stack->node(), LCC_SCENE_MEMORY_SPACE, s_scene_space);
 
     s_status = LCC_STATUS_RUNNING;
     ESP_LOGI(TAG, "LCC node initialized and running");
@@ -567,6 +908,11 @@ uint16_t lcc_node_get_screen_timeout_sec(void)
     return s_screen_timeout_sec;
 }
 
+bool lcc_node_get_profiling_enabled(void)
+{
+    return s_profiling_enabled;
+}
+
 esp_err_t lcc_node_send_lighting_event(uint8_t parameter, uint8_t value)
 {
     if (s_status != LCC_STATUS_RUNNING || !s_stack) {
@@ -28,6 +28,15 @@ extern "C" {
  */
 #define LCC_DEFAULT_NODE_ID 0x050101019F6000ULL
 
+/**
+ * @brief Memory space holding the scene library
+ * 
+ * Contents are a scenes.bin image (see scene_bin.h) of the default scene
+ * category. Reading from address 0 returns the current library; writing a
+ * complete image from address 0 replaces it once its CRC checks out.
+ */
+#define LCC_SCENE_MEMORY_SPACE 0x53
+
 /**
  * @brief LCC Node status
  */
@@ -111,6 +120,15 @@ uint16_t lcc_node_get_auto_apply_duration_sec(void);
  */
 uint16_t lcc_node_get_screen_timeout_sec(void);
 
+/**
+ * @brief Get whether the UI profiling overlay is enabled
+ * 
+ * Follows the CDI Diagnostics setting, including changes made at runtime.
+ * 
+ * @return true if profiling is enabled
+ */
+bool lcc_node_get_profiling_enabled(void);
+
 /**
  * @brief Send a lighting parameter event
  * 
@@ -0,0 +1,186 @@
+/**
+ * @file scene_bin.c
+ * @brief Binary scene index implementation
+ */
+
+#include "scene_bin.h"
+#include "scene_storage.h"
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+#include "esp_heap_caps.h"
+#include <stdio.h>
+#include <string.h>
+#include <stddef.h>
+
+static const char *TAG = "scene_bin";
+
+_Static_assert(sizeof(scene_bin_header_t) == 64, "scene_bin_header_t must be 64 bytes");
+_Static_assert(sizeof(scene_bin_record_t) == SCENE_BIN_RECORD_SIZE, "scene_bin_record_t size");
+
+void scene_bin_pack(const ui_scene_t *scene, scene_bin_record_t *record)
+{
+    memset(record, 0, sizeof(*record));
+    strncpy(record->name, scene->name, sizeof(record->name) - 1);
+    record->brightness = scene->brightness;
+    record->red = scene->red;
+    record->green = scene->green;
+    record->blue = scene->blue;
+    record->white = scene->white;
+}
+
+void scene_bin_unpack(const scene_bin_record_t *record, ui_scene_t *scene)
+{
+    memcpy(scene->name, record->name, sizeof(scene->name));
+    scene->name[sizeof(scene->name) - 1] = '\0';
+    scene->brightness = record->brightness;
+    scene->red = record->red;
+    scene->green = record->green;
+    scene->blue = record->blue;
+    scene->white = record->white;
+}
+
+/**
+ * @brief CRC of the header fields preceding crc32 (start of the file CRC)
+ */
+static uint32_t header_crc(const scene_bin_header_t *header)
+{
+    return esp_rom_crc32_le(0, (const uint8_t *)header, offsetof(scene_bin_header_t, crc32));
+}
+
+void scene_bin_make_header(scene_bin_header_t *header, const scene_bin_record_t *records,
+                           size_t count, const struct stat *source)
+{
+    memset(header, 0, sizeof(*header));
+    header->magic = SCENE_BIN_MAGIC;
+    header->version = SCENE_BIN_VERSION;
+    header->record_size = SCENE_BIN_RECORD_SIZE;
+    header->count = count;
+    if (source) {
+        header->source_mtime = (uint32_t)source->st_mtime;
+        header->source_size = (uint32_t)source->st_size;
+    }
+    header->crc32 = esp_rom_crc32_le(header_crc(header), (const uint8_t *)records,
+                                     count * sizeof(scene_bin_record_t));
+}
+
+bool scene_bin_verify(const scene_bin_header_t *header, const scene_bin_record_t *records)
+{
+    if (header->magic != SCENE_BIN_MAGIC ||
+        header->version != SCENE_BIN_VERSION ||
+        header->record_size != SCENE_BIN_RECORD_SIZE ||
+        header->count > SCENE_STORAGE_MAX_SCENES) {
+        return false;
+    }
+    uint32_t crc = esp_rom_crc32_le(header_crc(header), (const uint8_t *)records,
+                                    header->count * sizeof(scene_bin_record_t));
+    return crc == header->crc32;
+}
+
+esp_err_t scene_bin_read(const char *path, const struct stat *source,
+                         scene_bin_record_t **out_records, size_t *out_count)
+{
+    if (!path || !source || !out_records || !out_count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    *out_records = NULL;
+    *out_count = 0;
+
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    scene_bin_header_t header;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        header.magic != SCENE_BIN_MAGIC ||
+        header.version != SCENE_BIN_VERSION ||
+        header.record_size != SCENE_BIN_RECORD_SIZE ||
+        header.count > SCENE_STORAGE_MAX_SCENES) {
+        fclose(file);
+        ESP_LOGW(TAG, "%s: header invalid", path);
+        return ESP_ERR_INVALID_CRC;
+    }
+
+    if (header.source_mtime != (uint32_t)source->st_mtime ||
+        header.source_size != (uint32_t)source->st_size) {
+        fclose(file);
+        ESP_LOGI(TAG, "%s is stale (JSON changed)", path);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    scene_bin_record_t *records = NULL;
+    if (header.count > 0) {
+        records = heap_caps_malloc(header.count * sizeof(scene_bin_record_t),
+                                   MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!records) {
+            fclose(file);
+            ESP_LOGE(TAG, "Failed to allocate %d scene records", (int)header.count);
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    // All records in one read
+    size_t read = header.count > 0 ?
+        fread(records, sizeof(scene_bin_record_t), header.count, file) : 0;
+    fclose(file);
+
+    if (read != header.count || !scene_bin_verify(&header, records)) {
+        ESP_LOGW(TAG, "%s: CRC mismatch", path);
+        heap_caps_free(records);
+        return ESP_ERR_INVALID_CRC;
+    }
+
+    *out_records = records;
+    *out_count = header.count;
+    return ESP_OK;
+}
+
+esp_err_t scene_bin_write(const char *path, const struct stat *source,
+                          const ui_scene_t *scenes, size_t count)
+{
+    if (!path || !source || (!scenes && count > 0) || count > SCENE_STORAGE_MAX_SCENES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // First pass: CRC, so the header can be written before the records
+    scene_bin_header_t header;
+    scene_bin_make_header(&header, NULL, 0, source);
+    header.count = count;
+    scene_bin_record_t record;
+    uint32_t crc = header_crc(&header);
+    for (size_t i = 0; i < count; i++) {
+        scene_bin_pack(&scenes[i], &record);
+        crc = esp_rom_crc32_le(crc, (const uint8_t *)&record, sizeof(record));
+    }
+    header.crc32 = crc;
+
+    // A torn write is caught by the CRC on the next load, so no temp file
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        ESP_LOGW(TAG, "Failed to open %s for writing", path);
+        return ESP_FAIL;
+    }
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    for (size_t i = 0; ok && i < count; i++) {
+        scene_bin_pack(&scenes[i], &record);
+        ok = fwrite(&record, sizeof(record), 1, file) == 1;
+    }
+    fflush(file);
+    fclose(file);
+
+    if (!ok) {
+        ESP_LOGW(TAG, "Failed to write %s", path);
+        scene_bin_invalidate(path);
+        return ESP_FAIL;
+    }
+
+    ESP_LOGD(TAG, "Wrote %s: %d records", path, (int)count);
+    return ESP_OK;
+}
+
+void scene_bin_invalidate(const char *path)
+{
+    remove(path);
+}
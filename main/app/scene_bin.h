@@ -0,0 +1,128 @@
+/**
+ * @file scene_bin.h
+ * @brief Binary scene index (scenes.bin)
+ *
+ * Fixed-record binary copy of a scene JSON file (scenes.json or a category
+ * file) that can be loaded with a single read. The JSON file remains the
+ * human-editable source of truth; the index records the size and mtime of
+ * the JSON it was built from and is ignored when either no longer matches,
+ * or when its CRC is wrong.
+ *
+ * File layout (little-endian):
+ * - 64-byte header (scene_bin_header_t)
+ * - count x 64-byte records (scene_bin_record_t)
+ */
+
+#pragma once
+
+#include "esp_err.h"
+#include "../ui/ui_common.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/stat.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SCENE_BIN_PATH          "/sdcard/scenes.bin"    ///< Index of scenes.json
+#define SCENE_BIN_MAGIC         0x424E4353u     ///< "SCNB"
+#define SCENE_BIN_VERSION       1
+#define SCENE_BIN_RECORD_SIZE   64
+
+/**
+ * @brief scenes.bin file header
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;             ///< SCENE_BIN_MAGIC
+    uint16_t version;           ///< SCENE_BIN_VERSION
+    uint16_t record_size;       ///< SCENE_BIN_RECORD_SIZE
+    uint32_t count;             ///< Number of records that follow
+    uint32_t source_mtime;      ///< mtime of the JSON file this was built from
+    uint32_t source_size;       ///< Size of the JSON file this was built from
+    uint32_t crc32;             ///< CRC-32 of the header fields above plus all records
+    uint8_t reserved[40];       ///< Zero
+} scene_bin_header_t;
+
+/**
+ * @brief One scene record
+ */
+typedef struct __attribute__((packed)) {
+    char name[32];              ///< NUL terminated scene name
+    uint8_t brightness;
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+    uint8_t white;
+    uint8_t reserved[27];       ///< Zero
+} scene_bin_record_t;
+
+/**
+ * @brief Convert a scene to its binary record
+ */
+void scene_bin_pack(const ui_scene_t *scene, scene_bin_record_t *record);
+
+/**
+ * @brief Convert a binary record to a scene
+ */
+void scene_bin_unpack(const scene_bin_record_t *record, ui_scene_t *scene);
+
+/**
+ * @brief Fill in a header for a set of records, including the CRC
+ *
+ * @param header Output header
+ * @param records Records that will follow the header
+ * @param count Number of records
+ * @param source Stat of the JSON file the records came from, or NULL
+ */
+void scene_bin_make_header(scene_bin_header_t *header, const scene_bin_record_t *records,
+                           size_t count, const struct stat *source);
+
+/**
+ * @brief Check header magic, version, record size and CRC
+ *
+ * @param header Header to check
+ * @param records Records that followed the header
+ * @return true if header and records are consistent
+ */
+bool scene_bin_verify(const scene_bin_header_t *header, const scene_bin_record_t *records);
+
+/**
+ * @brief Read all records of the binary index in a single read
+ *
+ * @param path Path of the index file
+ * @param source Stat of the JSON file; the index is rejected if it was
+ *               built from a different version of the file
+ * @param out_records Output: PSRAM array of records, free with heap_caps_free()
+ *                    (NULL when the index is empty)
+ * @param out_count Output: number of records
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NOT_FOUND if there is no index,
+ *                   ESP_ERR_INVALID_STATE if it is stale, ESP_ERR_INVALID_CRC
+ *                   if it is corrupt, ESP_ERR_NO_MEM
+ */
+esp_err_t scene_bin_read(const char *path, const struct stat *source,
+                         scene_bin_record_t **out_records, size_t *out_count);
+
+/**
+ * @brief Write the binary index for a set of scenes
+ *
+ * @param path Path of the index file
+ * @param source Stat of the JSON file just written for these scenes
+ * @param scenes Scenes to write
+ * @param count Number of scenes
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t scene_bin_write(const char *path, const struct stat *source,
+                          const ui_scene_t *scenes, size_t count);
+
+/**
+ * @brief Delete a binary index (forces the next load to use JSON)
+ *
+ * @param path Path of the index file
+ */
+void scene_bin_invalidate(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,661 @@
+/**
+ * @file scene_json.c
+ * @brief Streaming scenes.json parser implementation
+ *
+ * Single pass tokenizer over a fixed read buffer. Only the values needed
+ * for ui_scene_t are decoded; everything else is validated and skipped.
+ * Each scene is decoded into a local ui_scene_t and handed to the caller.
+ * Nested containers are skipped iteratively using a bit stack, so deep
+ * documents cannot overflow the calling task's stack.
+ */
+
+#include "scene_json.h"
+#include "esp_log.h"
+#include <ctype.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static const char *TAG = "scene_json";
+
+/// Same nesting limit as cJSON (CJSON_NESTING_LIMIT)
+#define JSON_NESTING_LIMIT  1000
+
+/// Longest number literal accepted (cJSON has no limit, real files use 1-3 digits)
+#define JSON_NUMBER_MAX_LEN 64
+
+/// Longest object key we need to match ("brightness")
+#define JSON_KEY_MAX_LEN    16
+
+/// Scene fields, used as bit positions in the per-scene seen/valid masks
+enum {
+    FIELD_NAME = 0,
+    FIELD_BRIGHTNESS,
+    FIELD_R,
+    FIELD_G,
+    FIELD_B,
+    FIELD_W,
+    FIELD_COUNT
+};
+
+static const char *const s_field_keys[FIELD_COUNT] = {
+    "name", "brightness", "r", "g", "b", "w"
+};
+
+#define ALL_FIELDS_MASK  ((1u << FIELD_COUNT) - 1)
+
+/**
+ * @brief Buffered input stream over a file descriptor
+ */
+typedef struct {
+    int fd;
+    size_t pos;         ///< Read position in buf
+    size_t len;         ///< Valid bytes in buf
+    size_t consumed;    ///< Bytes consumed before buf (for error offsets)
+    bool eof;
+    char buf[SCENE_JSON_READ_BUF_SIZE];
+} json_stream_t;
+
+/**
+ * @brief Refill the read buffer, returns false at end of input
+ */
+static bool stream_fill(json_stream_t *s)
+{
+    if (s->eof) {
+        return false;
+    }
+    s->consumed += s->len;
+    s->pos = 0;
+    ssize_t n = read(s->fd, s->buf, sizeof(s->buf));
+    if (n <= 0) {
+        s->len = 0;
+        s->eof = true;
+        return false;
+    }
+    s->len = (size_t)n;
+    return true;
+}
+
+/**
+ * @brief Peek at the next byte, -1 at end of input
+ *
+ * A NUL byte ends the input, as cJSON_Parse() works on C strings.
+ */
+static inline int stream_peek(json_stream_t *s)
+{
+    if (s->pos >= s->len && !stream_fill(s)) {
+        return -1;
+    }
+    int c = (unsigned char)s->buf[s->pos];
+    return c == 0 ? -1 : c;
+}
+
+/**
+ * @brief Consume and return the next byte, -1 at end of input
+ */
+static inline int stream_next(json_stream_t *s)
+{
+    int c = stream_peek(s);
+    if (c >= 0) {
+        s->pos++;
+    }
+    return c;
+}
+
+static inline size_t stream_offset(const json_stream_t *s)
+{
+    return s->consumed + s->pos;
+}
+
+/**
+ * @brief Skip whitespace (cJSON treats every byte <= 32 as whitespace)
+ */
+static inline void skip_ws(json_stream_t *s)
+{
+    int c;
+    while ((c = stream_peek(s)) >= 0 && c <= 32) {
+        s->pos++;
+    }
+}
+
+static bool expect_char(json_stream_t *s, int expected)
+{
+    skip_ws(s);
+    return stream_next(s) == expected;
+}
+
+static bool expect_literal(json_stream_t *s, const char *literal)
+{
+    for (; *literal; literal++) {
+        if (stream_next(s) != (unsigned char)*literal) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int hex_value(int c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static bool parse_hex4(json_stream_t *s, uint32_t *out)
+{
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++) {
+        int h = hex_value(stream_next(s));
+        if (h < 0) {
+            return false;
+        }
+        value = (value << 4) | (uint32_t)h;
+    }
+    *out = value;
+    return true;
+}
+
+/**
+ * @brief Append bytes to a bounded output, silently truncating
+ */
+static inline void out_append(char *out, size_t out_size, size_t *out_len,
+                              const char *bytes, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        if (out && *out_len + 1 < out_size) {
+            out[*out_len] = bytes[i];
+        }
+        (*out_len)++;
+    }
+}
+
+/**
+ * @brief Parse a JSON string (opening quote already consumed)
+ *
+ * Decodes escapes the same way cJSON does, including UTF-16 surrogate
+ * pairs. Output is truncated to out_size - 1 bytes and NUL terminated.
+ *
+ * @param out Output buffer, or NULL to validate only
+ * @param truncated Set when the decoded string did not fit (may be NULL)
+ */
+static bool parse_string_body(json_stream_t *s, char *out, size_t out_size, bool *truncated)
+{
+    size_t len = 0;
+
+    while (true) {
+        int c = stream_next(s);
+        if (c < 0) {
+            return false;
+        }
+        if (c == '"') {
+            break;
+        }
+        if (c != '\\') {
+            char ch = (char)c;
+            out_append(out, out_size, &len, &ch, 1);
+            continue;
+        }
+
+        c = stream_next(s);
+        char esc;
+        switch (c) {
+            case 'b':  esc = '\b'; break;
+            case 'f':  esc = '\f'; break;
+            case 'n':  esc = '\n'; break;
+            case 'r':  esc = '\r'; break;
+            case 't':  esc = '\t'; break;
+            case '"':
+            case '\\':
+            case '/':  esc = (char)c; break;
+            case 'u': {
+                uint32_t codepoint;
+                if (!parse_hex4(s, &codepoint)) {
+                    return false;
+                }
+                if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+                    return false;  // Lone low surrogate
+                }
+                if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+                    uint32_t low;
+                    if (stream_next(s) != '\\' || stream_next(s) != 'u' ||
+                        !parse_hex4(s, &low) || low < 0xDC00 || low > 0xDFFF) {
+                        return false;
+                    }
+                    codepoint = 0x10000 + (((codepoint & 0x3FF) << 10) | (low & 0x3FF));
+                }
+
+                char utf8[4];
+                size_t n;
+                if (codepoint < 0x80) {
+                    utf8[0] = (char)codepoint;
+                    n = 1;
+                } else if (codepoint < 0x800) {
+                    utf8[0] = (char)(0xC0 | (codepoint >> 6));
+                    utf8[1] = (char)(0x80 | (codepoint & 0x3F));
+                    n = 2;
+                } else if (codepoint < 0x10000) {
+                    utf8[0] = (char)(0xE0 | (codepoint >> 12));
+                    utf8[1] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+                    utf8[2] = (char)(0x80 | (codepoint & 0x3F));
+                    n = 3;
+                } else {
+                    utf8[0] = (char)(0xF0 | (codepoint >> 18));
+                    utf8[1] = (char)(0x80 | ((codepoint >> 12) & 0x3F));
+                    utf8[2] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+                    utf8[3] = (char)(0x80 | (codepoint & 0x3F));
+                    n = 4;
+                }
+                out_append(out, out_size, &len, utf8, n);
+                continue;
+            }
+            default:
+                return false;
+        }
+        out_append(out, out_size, &len, &esc, 1);
+    }
+
+    if (out && out_size > 0) {
+        out[len < out_size ? len : out_size - 1] = '\0';
+    }
+    if (truncated) {
+        *truncated = (len >= out_size);
+    }
+    return true;
+}
+
+/**
+ * @brief Parse a JSON number and convert it like cJSON's valueint
+ *
+ * cJSON collects [0-9+-.eE] and hands them to strtod(); the whole run
+ * must be consumed or the following token is a syntax error anyway.
+ */
+static bool parse_number(json_stream_t *s, int *out_int)
+{
+    char num[JSON_NUMBER_MAX_LEN + 1];
+    size_t len = 0;
+    int c;
+
+    while ((c = stream_peek(s)) >= 0 &&
+           ((c >= '0' && c <= '9') || c == '+' || c == '-' ||
+            c == '.' || c == 'e' || c == 'E')) {
+        if (len >= JSON_NUMBER_MAX_LEN) {
+            ESP_LOGW(TAG, "Number literal too long");
+            return false;
+        }
+        num[len++] = (char)c;
+        s->pos++;
+    }
+    num[len] = '\0';
+
+    char *end = NULL;
+    double value = strtod(num, &end);
+    if (len == 0 || end != num + len) {
+        return false;
+    }
+
+    if (out_int) {
+        if (value >= INT_MAX) {
+            *out_int = INT_MAX;
+        } else if (value <= (double)INT_MIN) {
+            *out_int = INT_MIN;
+        } else {
+            *out_int = (int)value;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Parse a scalar value (string, number, true, false, null)
+ */
+static bool skip_scalar(json_stream_t *s, int c)
+{
+    switch (c) {
+        case '"':
+            s->pos++;
+            return parse_string_body(s, NULL, 0, NULL);
+        case 't':
+            return expect_literal(s, "true");
+        case 'f':
+            return expect_literal(s, "false");
+        case 'n':
+            return expect_literal(s, "null");
+        default:
+            if (c == '-' || (c >= '0' && c <= '9')) {
+                return parse_number(s, NULL);
+            }
+            return false;
+    }
+}
+
+/**
+ * @brief Parse an object key and the following ':' separator
+ */
+static bool parse_key(json_stream_t *s, char *key, size_t key_size, bool *truncated)
+{
+    if (!expect_char(s, '"')) {
+        return false;
+    }
+    if (!parse_string_body(s, key, key_size, truncated)) {
+        return false;
+    }
+    return expect_char(s, ':');
+}
+
+/**
+ * @brief Validate and discard any JSON value
+ *
+ * @param depth Nesting depth of the container holding this value
+ */
+static bool skip_value(json_stream_t *s, int depth)
+{
+    uint8_t is_object[(JSON_NESTING_LIMIT + 7) / 8];
+    int sp = 0;
+
+    while (true) {
+        // Parse one value
+        skip_ws(s);
+        int c = stream_peek(s);
+        if (c == '{' || c == '[') {
+            s->pos++;
+            if (depth + sp >= JSON_NESTING_LIMIT) {
+                return false;
+            }
+            if (c == '{') {
+                is_object[sp / 8] |= (uint8_t)(1u << (sp % 8));
+            } else {
+                is_object[sp / 8] &= (uint8_t)~(1u << (sp % 8));
+            }
+            sp++;
+
+            skip_ws(s);
+            if (stream_peek(s) == (c == '{' ? '}' : ']')) {
+                s->pos++;
+                sp--;
+            } else {
+                if (c == '{' && !parse_key(s, NULL, 0, NULL)) {
+                    return false;
+                }
+                continue;
+            }
+        } else if (!skip_scalar(s, c)) {
+            return false;
+        }
+
+        // Close finished containers until another value is expected
+        while (true) {
+            if (sp == 0) {
+                return true;
+            }
+            bool in_object = is_object[(sp - 1) / 8] & (1u << ((sp - 1) % 8));
+            skip_ws(s);
+            c = stream_next(s);
+            if (c == ',') {
+                if (in_object && !parse_key(s, NULL, 0, NULL)) {
+                    return false;
+                }
+                break;
+            }
+            if (c != (in_object ? '}' : ']')) {
+                return false;
+            }
+            sp--;
+        }
+    }
+}
+
+/**
+ * @brief Parse one element of the scenes array
+ *
+ * @param scene Output scene, or NULL to validate only
+ * @param valid Set when the element is an object with all fields present
+ *              and correctly typed
+ */
+static bool parse_scene(json_stream_t *s, ui_scene_t *scene, bool *valid)
+{
+    *valid = false;
+
+    skip_ws(s);
+    if (stream_peek(s) != '{') {
+        // Not an object: cJSON_GetObjectItem() finds nothing, scene is skipped
+        return skip_value(s, 2);
+    }
+    s->pos++;
+
+    unsigned seen = 0;
+    unsigned ok = 0;
+    int values[FIELD_COUNT] = {0};
+    char name[sizeof(scene->name)];
+    name[0] = '\0';
+
+    skip_ws(s);
+    if (stream_peek(s) == '}') {
+        s->pos++;
+        return true;
+    }
+
+    while (true) {
+        char key[JSON_KEY_MAX_LEN];
+        bool key_truncated = false;
+        if (!parse_key(s, key, sizeof(key), &key_truncated)) {
+            return false;
+        }
+
+        int field = -1;
+        if (!key_truncated) {
+            for (int i = 0; i < FIELD_COUNT; i++) {
+                if (!(seen & (1u << i)) && strcasecmp(key, s_field_keys[i]) == 0) {
+                    field = i;
+                    break;
+                }
+            }
+        }
+
+        skip_ws(s);
+        int c = stream_peek(s);
+        if (field < 0) {
+            if (!skip_value(s, 3)) {
+                return false;
+            }
+        } else {
+            seen |= (1u << field);
+            if (field == FIELD_NAME && c == '"') {
+                s->pos++;
+                if (!parse_string_body(s, name, sizeof(name), NULL)) {
+                    return false;
+                }
+                ok |= (1u << field);
+            } else if (field != FIELD_NAME && (c == '-' || (c >= '0' && c <= '9'))) {
+                if (!parse_number(s, &values[field])) {
+                    return false;
+                }
+                ok |= (1u << field);
+            } else if (!skip_value(s, 3)) {
+                return false;
+            }
+        }
+
+        skip_ws(s);
+        c = stream_next(s);
+        if (c == '}') {
+            break;
+        }
+        if (c != ',') {
+            return false;
+        }
+    }
+
+    if (ok == ALL_FIELDS_MASK) {
+        *valid = true;
+        if (scene) {
+            memcpy(scene->name, name, sizeof(scene->name));
+            scene->brightness = (uint8_t)values[FIELD_BRIGHTNESS];
+            scene->red = (uint8_t)values[FIELD_R];
+            scene->green = (uint8_t)values[FIELD_G];
+            scene->blue = (uint8_t)values[FIELD_B];
+            scene->white = (uint8_t)values[FIELD_W];
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Destination for parsed scenes
+ */
+typedef struct {
+    scene_json_scene_cb_t on_scene;
+    void *ctx;
+    size_t count;       ///< Scenes accepted by on_scene
+    bool full;          ///< on_scene refused a scene; validate only from here on
+} scene_sink_t;
+
+/**
+ * @brief Parse the scenes array (opening bracket already consumed)
+ */
+static bool parse_scenes_array(json_stream_t *s, scene_sink_t *sink)
+{
+    skip_ws(s);
+    if (stream_peek(s) == ']') {
+        s->pos++;
+        return true;
+    }
+
+    while (true) {
+        ui_scene_t scene;
+        bool valid = false;
+        if (!parse_scene(s, sink->full ? NULL : &scene, &valid)) {
+            return false;
+        }
+        if (!sink->full) {
+            if (!valid) {
+                ESP_LOGW(TAG, "Skipping invalid scene at index %d", (int)sink->count);
+            } else if (sink->on_scene(&scene, sink->ctx)) {
+                ESP_LOGD(TAG, "Loaded scene '%s': B=%d R=%d G=%d B=%d W=%d",
+                         scene.name, scene.brightness, scene.red, scene.green,
+                         scene.blue, scene.white);
+                sink->count++;
+            } else {
+                ESP_LOGW(TAG, "Scene limit reached (%d), ignoring remaining scenes",
+                         (int)sink->count);
+                sink->full = true;
+            }
+        }
+
+        skip_ws(s);
+        int c = stream_next(s);
+        if (c == ']') {
+            return true;
+        }
+        if (c != ',') {
+            return false;
+        }
+    }
+}
+
+/**
+ * @brief Parse the root object, filling scenes from the first 'scenes' key
+ */
+static bool parse_root(json_stream_t *s, scene_sink_t *sink, bool *found_array)
+{
+    bool seen_scenes = false;
+
+    // cJSON skips a UTF-8 byte order mark
+    if (stream_peek(s) == 0xEF) {
+        if (!expect_literal(s, "\xEF\xBB\xBF")) {
+            return false;
+        }
+    }
+
+    skip_ws(s);
+    int c = stream_peek(s);
+    if (c != '{') {
+        // Valid JSON but not an object: no 'scenes' member
+        return skip_value(s, 0);
+    }
+    s->pos++;
+
+    skip_ws(s);
+    if (stream_peek(s) == '}') {
+        s->pos++;
+        return true;
+    }
+
+    while (true) {
+        char key[JSON_KEY_MAX_LEN];
+        bool key_truncated = false;
+        if (!parse_key(s, key, sizeof(key), &key_truncated)) {
+            return false;
+        }
+
+        skip_ws(s);
+        bool is_scenes = !seen_scenes && !key_truncated && strcasecmp(key, "scenes") == 0;
+        if (is_scenes) {
+            seen_scenes = true;
+        }
+        if (is_scenes && stream_peek(s) == '[') {
+            s->pos++;
+            *found_array = true;
+            if (!parse_scenes_array(s, sink)) {
+                return false;
+            }
+        } else if (!skip_value(s, 1)) {
+            return false;
+        }
+
+        skip_ws(s);
+        c = stream_next(s);
+        if (c == '}') {
+            break;
+        }
+        if (c != ',') {
+            return false;
+        }
+    }
+
+    // Like cJSON_Parse(), content after the root value is ignored
+    return true;
+}
+
+esp_err_t scene_json_parse_file(const char *path, scene_json_scene_cb_t on_scene,
+                                void *ctx, size_t *out_count)
+{
+    if (!path || !on_scene || !out_count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    *out_count = 0;
+
+    json_stream_t stream = {
+        .fd = open(path, O_RDONLY),
+    };
+    if (stream.fd < 0) {
+        ESP_LOGE(TAG, "Failed to open %s", path);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    scene_sink_t sink = {
+        .on_scene = on_scene,
+        .ctx = ctx,
+    };
+    bool found_array = false;
+    bool ok = parse_root(&stream, &sink, &found_array);
+    close(stream.fd);
+
+    if (!ok) {
+        ESP_LOGE(TAG, "Failed to parse %s: syntax error near offset %u",
+                 path, (unsigned)stream_offset(&stream));
+        return ESP_FAIL;
+    }
+
+    if (!found_array) {
+        ESP_LOGE(TAG, "%s: 'scenes' is not an array", path);
+        return ESP_FAIL;
+    }
+
+    *out_count = sink.count;
+    return ESP_OK;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file scene_json.h
+ * @brief Streaming scenes.json parser
+ *
+ * Parses scenes.json scene by scene from a small fixed read buffer and
+ * hands each one to a callback. No DOM is built and no heap memory is
+ * allocated, so parse time and memory stay flat as the library grows.
+ *
+ * Accepts and rejects the same documents as cJSON_Parse() and extracts
+ * the same values as the previous cJSON_GetObjectItem() based loader:
+ * - Object keys are matched case-insensitively, first occurrence wins
+ * - Scenes with missing or mistyped fields are skipped, not fatal
+ * - Numbers are converted like cJSON valueint, then cast to uint8_t
+ * - Names longer than the ui_scene_t field are truncated
+ */
+
+#pragma once
+
+#include "esp_err.h"
+#include "../ui/ui_common.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Size of the fixed read buffer used while parsing (bytes)
+ *
+ * Matches the FAT sector size so each refill is a single sector read.
+ */
+#define SCENE_JSON_READ_BUF_SIZE    512
+
+/**
+ * @brief Called for each valid scene, in file order
+ *
+ * @param scene Decoded scene (only valid during the call)
+ * @param ctx Context passed to scene_json_parse_file()
+ * @return true to keep receiving scenes, false if no more can be stored
+ *         (the rest of the document is still validated)
+ */
+typedef bool (*scene_json_scene_cb_t)(const ui_scene_t *scene, void *ctx);
+
+/**
+ * @brief Parse a scenes.json file, streaming each scene to a callback
+ *
+ * The whole document is validated. On a syntax error ESP_FAIL is returned,
+ * although @p on_scene may already have been called for earlier scenes.
+ *
+ * @param path Path of the JSON file
+ * @param on_scene Callback receiving each valid scene
+ * @param ctx Context passed to @p on_scene
+ * @param out_count Output: number of scenes accepted by @p on_scene
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NOT_FOUND if the file cannot
+ *                   be opened, ESP_FAIL on malformed JSON or missing 'scenes'
+ */
+esp_err_t scene_json_parse_file(const char *path, scene_json_scene_cb_t on_scene,
+                                void *ctx, size_t *out_count);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,153 +1,524 @@
 /**
  * @file scene_storage.c
  * @brief Scene storage implementation - load/save scenes from/to SD card
+ *
+ * Scenes are grouped into categories. The default category is scenes.json;
+ * every <name>.json under SCENE_STORAGE_CATEGORY_DIR is another category
+ * with the same schema. Only the category list and the default category
+ * are read at boot. Other categories are loaded when opened and kept in a
+ * small LRU of scene tables.
  */
 
 #include "scene_storage.h"
-#include "cJSON.h"
+#include "scene_json.h"
+#include "scene_bin.h"
+#include "sdkconfig.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <strings.h>
+#include <dirent.h>
 #include <sys/stat.h>
 
 static const char *TAG = "scene_storage";
 
-// Cached scenes
-static ui_scene_t s_scenes[SCENE_STORAGE_MAX_SCENES];
-static size_t s_scene_count = 0;
+/// Initial table capacity; doubles as needed up to SCENE_STORAGE_MAX_SCENES
+#define SCENE_TABLE_MIN_CAPACITY    32
+
+/// Empty slot in the name index
+#define NAME_INDEX_EMPTY            0xFFFF
+
+/// Written first and renamed over scenes.json, so a torn write never replaces it
+#define SCENE_STORAGE_TMP_PATH      "/sdcard/scenes.tmp"
+
+/// Longest path built for a category file
+#define CATEGORY_PATH_MAX           (sizeof(SCENE_STORAGE_CATEGORY_DIR) + SCENE_STORAGE_CATEGORY_NAME_LEN + 8)
+
+_Static_assert(SCENE_STORAGE_MAX_SCENES < NAME_INDEX_EMPTY, "name index uses 16-bit slots");
 
 /**
- * @brief Initialize scene storage module
+ * @brief Scenes of one category with their name index
  */
-esp_err_t scene_storage_init(void)
+typedef struct {
+    ui_scene_t *scenes;         ///< PSRAM, grown on demand
+    size_t count;
+    size_t capacity;
+    uint16_t *name_index;       ///< Open addressing: name -> table position
+    size_t name_index_size;     ///< Power of two, at least 2x capacity
+} scene_table_t;
+
+/**
+ * @brief LRU cache slot holding a loaded category
+ */
+typedef struct {
+    int category;               ///< Category index, -1 if the slot is free
+    uint32_t last_used;         ///< LRU stamp
+    scene_table_t table;
+} category_slot_t;
+
+// Category names, [0] is the default category (scenes.json)
+static char (*s_category_names)[SCENE_STORAGE_CATEGORY_NAME_LEN] = NULL;
+static size_t s_category_count = 0;
+
+// Loaded categories; slot 0 always holds the default category
+static category_slot_t s_slots[SCENE_STORAGE_CATEGORY_CACHE];
+static category_slot_t *s_active = &s_slots[0];
+static uint32_t s_lru_clock = 0;
+
+static esp_err_t write_scenes_to_file(size_t category, const ui_scene_t *scenes, size_t count);
+
+/**
+ * @brief Build the JSON, index or temp file path of a category
+ *
+ * @param ext ".json", ".bin" or ".tmp"
+ */
+static void category_path(size_t category, const char *ext, char *buf, size_t size)
 {
-    ESP_LOGI(TAG, "Initializing scene storage");
-    
-    // Load scenes from SD card
-    size_t count = 0;
-    esp_err_t ret = scene_storage_load(s_scenes, SCENE_STORAGE_MAX_SCENES, &count);
-    if (ret == ESP_OK) {
-        s_scene_count = count;
-        ESP_LOGI(TAG, "Loaded %d scenes from SD card", s_scene_count);
+    if (category == 0) {
+        const char *path = SCENE_STORAGE_PATH;
+        if (strcmp(ext, ".bin") == 0) {
+            path = SCENE_BIN_PATH;
+        } else if (strcmp(ext, ".tmp") == 0) {
+            path = SCENE_STORAGE_TMP_PATH;
+        }
+        strncpy(buf, path, size - 1);
+        buf[size - 1] = '\0';
     } else {
-        ESP_LOGW(TAG, "Failed to load scenes: %s", esp_err_to_name(ret));
-        s_scene_count = 0;
+        snprintf(buf, size, "%s/%s%s", SCENE_STORAGE_CATEGORY_DIR,
+                 s_category_names[category], ext);
+    }
+}
+
+/**
+ * @brief FNV-1a hash of a scene name
+ */
+static uint32_t name_hash(const char *name)
+{
+    uint32_t hash = 2166136261u;
+    while (*name) {
+        hash ^= (uint8_t)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Rebuild the name index from the table
+ *
+ * Called after any change that adds, removes or moves scenes. Reallocates
+ * the index when the table capacity has outgrown it.
+ */
+static void name_index_rebuild(scene_table_t *t)
+{
+    size_t size = 64;
+    while (size < t->capacity * 2) {
+        size <<= 1;
+    }
+    
+    if (size != t->name_index_size) {
+        uint16_t *index = heap_caps_realloc(t->name_index, size * sizeof(uint16_t),
+                                            MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!index) {
+            // Lookups fall back to a linear scan
+            ESP_LOGW(TAG, "Failed to allocate name index");
+            heap_caps_free(t->name_index);
+            t->name_index = NULL;
+            t->name_index_size = 0;
+            return;
+        }
+        t->name_index = index;
+        t->name_index_size = size;
     }
     
-    return ESP_OK;
+    memset(t->name_index, 0xFF, t->name_index_size * sizeof(uint16_t));
+    size_t mask = t->name_index_size - 1;
+    for (size_t i = 0; i < t->count; i++) {
+        size_t slot = name_hash(t->scenes[i].name) & mask;
+        while (t->name_index[slot] != NAME_INDEX_EMPTY) {
+            slot = (slot + 1) & mask;
+        }
+        t->name_index[slot] = (uint16_t)i;
+    }
 }
 
 /**
- * @brief Load scenes from SD card
+ * @brief Find a scene by exact name, ignoring the scene at @p skip
+ *
+ * @param skip Table position to ignore, or -1 to search all scenes
+ * @return Table position, or -1 if not found
  */
-esp_err_t scene_storage_load(ui_scene_t *scenes, size_t max_count, size_t *out_count)
+static int find_other_by_name(const scene_table_t *t, const char *name, int skip)
 {
-    if (!scenes || !out_count) {
-        return ESP_ERR_INVALID_ARG;
+    if (!t->name_index) {
+        for (size_t i = 0; i < t->count; i++) {
+            if ((int)i != skip && strcmp(t->scenes[i].name, name) == 0) {
+                return (int)i;
+            }
+        }
+        return -1;
+    }
+    
+    size_t mask = t->name_index_size - 1;
+    size_t slot = name_hash(name) & mask;
+    while (t->name_index[slot] != NAME_INDEX_EMPTY) {
+        uint16_t i = t->name_index[slot];
+        if (i != skip && strcmp(t->scenes[i].name, name) == 0) {
+            return i;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return -1;
+}
+
+/**
+ * @brief Find a scene by exact name
+ *
+ * @return Table position, or -1 if not found
+ */
+static int find_by_name(const scene_table_t *t, const char *name)
+{
+    return find_other_by_name(t, name, -1);
+}
+
+/**
+ * @brief Make room for at least @p capacity scenes
+ */
+static esp_err_t table_reserve(scene_table_t *t, size_t capacity)
+{
+    if (capacity > SCENE_STORAGE_MAX_SCENES) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (capacity <= t->capacity) {
+        return ESP_OK;
     }
     
-    *out_count = 0;
+    size_t new_capacity = t->capacity ? t->capacity : SCENE_TABLE_MIN_CAPACITY;
+    while (new_capacity < capacity) {
+        new_capacity *= 2;
+    }
+    if (new_capacity > SCENE_STORAGE_MAX_SCENES) {
+        new_capacity = SCENE_STORAGE_MAX_SCENES;
+    }
+    
+    ui_scene_t *scenes = heap_caps_realloc(t->scenes, new_capacity * sizeof(ui_scene_t),
+                                           MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!scenes) {
+        ESP_LOGE(TAG, "Failed to grow scene table to %d entries", (int)new_capacity);
+        return ESP_ERR_NO_MEM;
+    }
+    
+    t->scenes = scenes;
+    t->capacity = new_capacity;
+    return ESP_OK;
+}
+
+/**
+ * @brief Release a table's memory
+ */
+static void table_free(scene_table_t *t)
+{
+    heap_caps_free(t->scenes);
+    heap_caps_free(t->name_index);
+    memset(t, 0, sizeof(*t));
+}
+
+/**
+ * @brief scene_json callback: append a parsed scene to the table
+ */
+static bool append_parsed_scene(const ui_scene_t *scene, void *ctx)
+{
+    scene_table_t *t = ctx;
+    if (table_reserve(t, t->count + 1) != ESP_OK) {
+        return false;
+    }
+    t->scenes[t->count++] = *scene;
+    return true;
+}
+
+/**
+ * @brief Load one category from SD card into a table
+ */
+static esp_err_t load_category(size_t category, scene_table_t *t)
+{
+    char json_path[CATEGORY_PATH_MAX];
+    char tmp_path[CATEGORY_PATH_MAX];
+    category_path(category, ".json", json_path, sizeof(json_path));
+    category_path(category, ".tmp", tmp_path, sizeof(tmp_path));
     
     // Check if file exists (also check for .tmp as fallback from failed rename)
     struct stat st;
-    const char *file_path = SCENE_STORAGE_PATH;
+    const char *file_path = json_path;
+    bool using_tmp = false;
     
-    if (stat(SCENE_STORAGE_PATH, &st) != 0) {
+    t->count = 0;
+    
+    if (stat(json_path, &st) != 0) {
         // Try fallback to .tmp file (from previous failed atomic write)
-        if (stat("/sdcard/scenes.tmp", &st) == 0) {
-            file_path = "/sdcard/scenes.tmp";
-            ESP_LOGW(TAG, "Using fallback scenes.tmp");
+        if (stat(tmp_path, &st) == 0) {
+            file_path = tmp_path;
+            using_tmp = true;
+            ESP_LOGW(TAG, "Using fallback %s", tmp_path);
             // Try to fix it by renaming
-            rename("/sdcard/scenes.tmp", SCENE_STORAGE_PATH);
+            if (rename(tmp_path, json_path) == 0) {
+                file_path = json_path;
+                using_tmp = false;
+            }
         } else {
-            ESP_LOGW(TAG, "scenes.json not found");
+            ESP_LOGW(TAG, "%s not found", json_path);
+            name_index_rebuild(t);
             return ESP_ERR_NOT_FOUND;
         }
     }
     
-    // Read file
-    FILE *file = fopen(file_path, "r");
-    if (!file) {
-        ESP_LOGE(TAG, "Failed to open scenes.json");
-        return ESP_FAIL;
+#if CONFIG_SCENE_BINARY_INDEX
+    char bin_path[CATEGORY_PATH_MAX];
+    category_path(category, ".bin", bin_path, sizeof(bin_path));
+    
+    // Fast path: binary index built from this exact JSON file
+    if (!using_tmp) {
+        int64_t bin_start_us = esp_timer_get_time();
+        scene_bin_record_t *records = NULL;
+        size_t bin_count = 0;
+        if (scene_bin_read(bin_path, &st, &records, &bin_count) == ESP_OK &&
+            table_reserve(t, bin_count) == ESP_OK) {
+            for (size_t i = 0; i < bin_count; i++) {
+                scene_bin_unpack(&records[i], &t->scenes[i]);
+            }
+            heap_caps_free(records);
+            t->count = bin_count;
+            name_index_rebuild(t);
+            ESP_LOGI(TAG, "Loaded %d scenes from %s in %lld us", (int)bin_count, bin_path,
+                     (long long)(esp_timer_get_time() - bin_start_us));
+            return ESP_OK;
+        }
+        heap_caps_free(records);
     }
+#endif
     
-    // Allocate buffer for file content
-    char *json_buf = malloc(st.st_size + 1);
-    if (!json_buf) {
-        fclose(file);
-        ESP_LOGE(TAG, "Failed to allocate memory for JSON");
-        return ESP_ERR_NO_MEM;
+    // Stream-parse straight into the scene table (no DOM)
+    size_t heap_before = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    int64_t start_us = esp_timer_get_time();
+    
+    size_t count = 0;
+    esp_err_t ret = scene_json_parse_file(file_path, append_parsed_scene, t, &count);
+    
+    int64_t elapsed_us = esp_timer_get_time() - start_us;
+    size_t heap_after = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to load %s: %s", file_path, esp_err_to_name(ret));
+        t->count = 0;
+        name_index_rebuild(t);
+        return ret == ESP_ERR_NOT_FOUND ? ESP_FAIL : ret;
     }
     
-    size_t read_size = fread(json_buf, 1, st.st_size, file);
-    fclose(file);
-    json_buf[read_size] = '\0';
+    name_index_rebuild(t);
     
-    // Parse JSON
-    cJSON *root = cJSON_Parse(json_buf);
-    free(json_buf);
+    ESP_LOGI(TAG, "Parsed %d scenes from %s (%ld bytes) in %lld us, heap delta %d bytes",
+             (int)count, file_path, (long)st.st_size, (long long)elapsed_us,
+             (int)heap_before - (int)heap_after);
     
-    if (!root) {
-        ESP_LOGE(TAG, "Failed to parse scenes.json: %s", cJSON_GetErrorPtr());
-        return ESP_FAIL;
+#if CONFIG_SCENE_BINARY_INDEX
+    // Rebuild the index so the next load can skip JSON parsing
+    if (!using_tmp && stat(json_path, &st) == 0) {
+        scene_bin_write(bin_path, &st, t->scenes, t->count);
     }
+#endif
     
-    // Get scenes array
-    cJSON *scenes_array = cJSON_GetObjectItem(root, "scenes");
-    if (!cJSON_IsArray(scenes_array)) {
-        ESP_LOGE(TAG, "scenes.json: 'scenes' is not an array");
-        cJSON_Delete(root);
-        return ESP_FAIL;
+    return ESP_OK;
+}
+
+/**
+ * @brief qsort comparator for category names
+ */
+static int compare_category_names(const void *a, const void *b)
+{
+    return strcasecmp((const char *)a, (const char *)b);
+}
+
+/**
+ * @brief Build the category list from the category directory
+ *
+ * Only directory entries are read here; category files are not opened.
+ */
+static void scan_categories(void)
+{
+    heap_caps_free(s_category_names);
+    s_category_names = heap_caps_calloc(SCENE_STORAGE_MAX_CATEGORIES,
+                                        SCENE_STORAGE_CATEGORY_NAME_LEN,
+                                        MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    s_category_count = 0;
+    if (!s_category_names) {
+        ESP_LOGE(TAG, "Failed to allocate category list");
+        return;
+    }
+    
+    strncpy(s_category_names[0], SCENE_STORAGE_DEFAULT_CATEGORY, SCENE_STORAGE_CATEGORY_NAME_LEN - 1);
+    s_category_count = 1;
+    
+    DIR *dir = opendir(SCENE_STORAGE_CATEGORY_DIR);
+    if (!dir) {
+        ESP_LOGI(TAG, "No %s directory, using %s only", SCENE_STORAGE_CATEGORY_DIR,
+                 SCENE_STORAGE_DEFAULT_CATEGORY);
+        return;
+    }
+    
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        size_t len = strlen(entry->d_name);
+        if (entry->d_type == DT_DIR || len <= 5 ||
+            strcasecmp(entry->d_name + len - 5, ".json") != 0) {
+            continue;
+        }
+        len -= 5;
+        if (len >= SCENE_STORAGE_CATEGORY_NAME_LEN) {
+            ESP_LOGW(TAG, "Skipping category with long name: %s", entry->d_name);
+            continue;
+        }
+        if (s_category_count >= SCENE_STORAGE_MAX_CATEGORIES) {
+            ESP_LOGW(TAG, "Category limit reached (%d), ignoring %s",
+                     SCENE_STORAGE_MAX_CATEGORIES, entry->d_name);
+            continue;
+        }
+    
+        char *name = s_category_names[s_category_count];
+        memcpy(name, entry->d_name, len);
+        name[len] = '\0';
+        if (strcasecmp(name, SCENE_STORAGE_DEFAULT_CATEGORY) == 0) {
+            continue;  // Would shadow scenes.json
+        }
+        s_category_count++;
     }
+    closedir(dir);
     
-    // Parse each scene
-    size_t count = 0;
-    cJSON *scene_obj = NULL;
-    cJSON_ArrayForEach(scene_obj, scenes_array) {
-        if (count >= max_count) {
-            ESP_LOGW(TAG, "Scene limit reached (%d), ignoring remaining scenes", max_count);
+    // Default first, the rest alphabetical
+    qsort(s_category_names[1], s_category_count - 1, SCENE_STORAGE_CATEGORY_NAME_LEN,
+          compare_category_names);
+    
+    ESP_LOGI(TAG, "Found %d scene categories", (int)s_category_count);
+}
+
+/**
+ * @brief Initialize scene storage module
+ */
+esp_err_t scene_storage_init(void)
+{
+    ESP_LOGI(TAG, "Initializing scene storage");
+    
+    for (size_t i = 0; i < SCENE_STORAGE_CATEGORY_CACHE; i++) {
+        s_slots[i].category = -1;
+    }
+    
+    scan_categories();
+    
+    // Only the default category is needed at boot (carousel + auto-apply)
+    s_slots[0].category = 0;
+    s_active = &s_slots[0];
+    esp_err_t ret = scene_storage_load();
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "Loaded %d scenes from SD card", (int)s_active->table.count);
+    } else {
+        ESP_LOGW(TAG, "Failed to load scenes: %s", esp_err_to_name(ret));
+    }
+    
+    return ESP_OK;
+}
+
+/**
+ * @brief Reload the active category from SD card
+ */
+esp_err_t scene_storage_load(void)
+{
+    return load_category(s_active->category, &s_active->table);
+}
+
+/**
+ * @brief Get the number of scene categories
+ */
+size_t scene_storage_get_category_count(void)
+{
+    return s_category_count;
+}
+
+/**
+ * @brief Get a category name
+ */
+const char *scene_storage_get_category_name(size_t index)
+{
+    if (index >= s_category_count) {
+        return NULL;
+    }
+    return s_category_names[index];
+}
+
+/**
+ * @brief Get the index of the active category
+ */
+size_t scene_storage_get_active_category(void)
+{
+    return (size_t)s_active->category;
+}
+
+/**
+ * @brief Make a category active, loading it if it is not cached
+ */
+esp_err_t scene_storage_open_category(size_t index)
+{
+    if (index >= s_category_count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    // Already cached?
+    category_slot_t *slot = NULL;
+    for (size_t i = 0; i < SCENE_STORAGE_CATEGORY_CACHE; i++) {
+        if (s_slots[i].category == (int)index) {
+            slot = &s_slots[i];
             break;
         }
-        
-        cJSON *name = cJSON_GetObjectItem(scene_obj, "name");
-        cJSON *brightness = cJSON_GetObjectItem(scene_obj, "brightness");
-        cJSON *r = cJSON_GetObjectItem(scene_obj, "r");
-        cJSON *g = cJSON_GetObjectItem(scene_obj, "g");
-        cJSON *b = cJSON_GetObjectItem(scene_obj, "b");
-        cJSON *w = cJSON_GetObjectItem(scene_obj, "w");
-        
-        if (!cJSON_IsString(name) || !cJSON_IsNumber(brightness) ||
-            !cJSON_IsNumber(r) || !cJSON_IsNumber(g) || 
-            !cJSON_IsNumber(b) || !cJSON_IsNumber(w)) {
-            ESP_LOGW(TAG, "Skipping invalid scene at index %d", count);
-            continue;
+    }
+    
+    if (!slot) {
+        // Free slot, else evict the least recently used one. Slot 0 (default
+        // category) and the active slot are never evicted.
+        for (size_t i = 1; i < SCENE_STORAGE_CATEGORY_CACHE; i++) {
+            if (&s_slots[i] == s_active) {
+                continue;
+            }
+            if (s_slots[i].category < 0) {
+                slot = &s_slots[i];
+                break;
+            }
+            if (!slot || s_slots[i].last_used < slot->last_used) {
+                slot = &s_slots[i];
+            }
+        }
+        if (!slot) {
+            slot = s_active;  // Cache too small to keep anything else
+        }
+    
+        // Load aside so a failure leaves the slot (possibly the active one) intact
+        scene_table_t loaded = {0};
+        esp_err_t ret = load_category(index, &loaded);
+        if (ret != ESP_OK) {
+            table_free(&loaded);
+            return ret;
         }
-        
-        // Copy scene data
-        strncpy(scenes[count].name, name->valuestring, sizeof(scenes[count].name) - 1);
-        scenes[count].name[sizeof(scenes[count].name) - 1] = '\0';
-        scenes[count].brightness = (uint8_t)brightness->valueint;
-        scenes[count].red = (uint8_t)r->valueint;
-        scenes[count].green = (uint8_t)g->valueint;
-        scenes[count].blue = (uint8_t)b->valueint;
-        scenes[count].white = (uint8_t)w->valueint;
-        
-        ESP_LOGI(TAG, "Loaded scene '%s': B=%d R=%d G=%d B=%d W=%d",
-                 scenes[count].name, scenes[count].brightness,
-                 scenes[count].red, scenes[count].green,
-                 scenes[count].blue, scenes[count].white);
-        
-        count++;
-    }
-    
-    cJSON_Delete(root);
-    *out_count = count;
-    
-    // Update cache
-    memcpy(s_scenes, scenes, count * sizeof(ui_scene_t));
-    s_scene_count = count;
     
+        if (slot->category >= 0) {
+            ESP_LOGI(TAG, "Evicting category '%s'", s_category_names[slot->category]);
+        }
+        table_free(&slot->table);
+        slot->table = loaded;
+        slot->category = (int)index;
+    }
+    
+    slot->last_used = ++s_lru_clock;
+    s_active = slot;
+    ESP_LOGI(TAG, "Opened category '%s' (%d scenes)", s_category_names[index],
+             (int)slot->table.count);
     return ESP_OK;
 }
 
@@ -161,99 +532,46 @@ esp_err_t scene_storage_save(const char *name, uint8_t brightness,
         return ESP_ERR_INVALID_ARG;
     }
     
+    scene_table_t *t = &s_active->table;
+    
     ESP_LOGI(TAG, "Saving scene '%s': B=%d R=%d G=%d B=%d W=%d",
              name, brightness, red, green, blue, white);
     
-    // Load existing scenes
-    ui_scene_t scenes[SCENE_STORAGE_MAX_SCENES];
-    size_t count = 0;
-    scene_storage_load(scenes, SCENE_STORAGE_MAX_SCENES, &count);
-    
     // Check if scene with same name exists (update) or add new
-    int existing_idx = -1;
-    for (size_t i = 0; i < count; i++) {
-        if (strcmp(scenes[i].name, name) == 0) {
-            existing_idx = i;
-            break;
-        }
-    }
+    int existing_idx = find_by_name(t, name);
+    ui_scene_t *scene;
     
     if (existing_idx >= 0) {
         // Update existing scene
-        scenes[existing_idx].brightness = brightness;
-        scenes[existing_idx].red = red;
-        scenes[existing_idx].green = green;
-        scenes[existing_idx].blue = blue;
-        scenes[existing_idx].white = white;
-        ESP_LOGI(TAG, "Updated existing scene at index %d", existing_idx);
+        scene = &t->scenes[existing_idx];
+        ESP_LOGI(TAG, "Updating existing scene at index %d", existing_idx);
     } else {
         // Add new scene
-        if (count >= SCENE_STORAGE_MAX_SCENES) {
+        if (table_reserve(t, t->count + 1) != ESP_OK) {
             ESP_LOGE(TAG, "Scene limit reached, cannot add new scene");
             return ESP_ERR_NO_MEM;
         }
-        strncpy(scenes[count].name, name, sizeof(scenes[count].name) - 1);
-        scenes[count].name[sizeof(scenes[count].name) - 1] = '\0';
-        scenes[count].brightness = brightness;
-        scenes[count].red = red;
-        scenes[count].green = green;
-        scenes[count].blue = blue;
-        scenes[count].white = white;
-        count++;
-        ESP_LOGI(TAG, "Added new scene at index %d", (int)(count - 1));
-    }
-    
-    // Build JSON
-    cJSON *root = cJSON_CreateObject();
-    cJSON *scenes_array = cJSON_CreateArray();
-    
-    for (size_t i = 0; i < count; i++) {
-        cJSON *scene_obj = cJSON_CreateObject();
-        cJSON_AddStringToObject(scene_obj, "name", scenes[i].name);
-        cJSON_AddNumberToObject(scene_obj, "brightness", scenes[i].brightness);
-        cJSON_AddNumberToObject(scene_obj, "r", scenes[i].red);
-        cJSON_AddNumberToObject(scene_obj, "g", scenes[i].green);
-        cJSON_AddNumberToObject(scene_obj, "b", scenes[i].blue);
-        cJSON_AddNumberToObject(scene_obj, "w", scenes[i].white);
-        cJSON_AddItemToArray(scenes_array, scene_obj);
+        scene = &t->scenes[t->count++];
+        strncpy(scene->name, name, sizeof(scene->name) - 1);
+        scene->name[sizeof(scene->name) - 1] = '\0';
+        name_index_rebuild(t);
+        ESP_LOGI(TAG, "Adding new scene at index %d", (int)(t->count - 1));
     }
     
-    cJSON_AddItemToObject(root, "scenes", scenes_array);
-    
-    // Write directly to scenes.json (FAT doesn't support atomic rename well)
-    char *json_str = cJSON_Print(root);
-    cJSON_Delete(root);
-    
-    if (!json_str) {
-        ESP_LOGE(TAG, "Failed to serialize JSON");
-        return ESP_FAIL;
-    }
+    scene->brightness = brightness;
+    scene->red = red;
+    scene->green = green;
+    scene->blue = blue;
+    scene->white = white;
     
-    FILE *file = fopen(SCENE_STORAGE_PATH, "w");
-    if (!file) {
-        ESP_LOGE(TAG, "Failed to open scenes.json for writing");
-        free(json_str);
-        return ESP_FAIL;
-    }
-    
-    size_t json_len = strlen(json_str);
-    size_t written = fwrite(json_str, 1, json_len, file);
-    fflush(file);  // Ensure data is written to SD card
-    fclose(file);
-    free(json_str);
-    
-    if (written != json_len) {
-        ESP_LOGE(TAG, "Failed to write complete JSON (wrote %d of %d)", written, json_len);
-        return ESP_FAIL;
+    esp_err_t ret = write_scenes_to_file(s_active->category, t->scenes, t->count);
+    if (ret != ESP_OK) {
+        // Reload from file to restore consistent state
+        scene_storage_load();
+        return ret;
     }
     
-    ESP_LOGI(TAG, "Wrote %d bytes to %s", json_len, SCENE_STORAGE_PATH);
-    
-    // Update cache
-    memcpy(s_scenes, scenes, count * sizeof(ui_scene_t));
-    s_scene_count = count;
-    
-    ESP_LOGI(TAG, "Scene saved successfully, total scenes: %d", count);
+    ESP_LOGI(TAG, "Scene saved successfully, total scenes: %d", (int)t->count);
     return ESP_OK;
 }
 
@@ -266,79 +584,38 @@ esp_err_t scene_storage_delete(const char *name)
         return ESP_ERR_INVALID_ARG;
     }
     
-    // Load existing scenes
-    ui_scene_t scenes[SCENE_STORAGE_MAX_SCENES];
-    size_t count = 0;
-    scene_storage_load(scenes, SCENE_STORAGE_MAX_SCENES, &count);
+    scene_table_t *t = &s_active->table;
     
     // Find and remove scene
-    int found_idx = -1;
-    for (size_t i = 0; i < count; i++) {
-        if (strcmp(scenes[i].name, name) == 0) {
-            found_idx = i;
-            break;
-        }
-    }
-    
+    int found_idx = find_by_name(t, name);
     if (found_idx < 0) {
         ESP_LOGW(TAG, "Scene '%s' not found", name);
         return ESP_ERR_NOT_FOUND;
     }
     
     // Shift remaining scenes
-    for (size_t i = found_idx; i < count - 1; i++) {
-        scenes[i] = scenes[i + 1];
-    }
-    count--;
-    
-    // Build and save JSON (same as save function)
-    cJSON *root = cJSON_CreateObject();
-    cJSON *scenes_array = cJSON_CreateArray();
-    
-    for (size_t i = 0; i < count; i++) {
-        cJSON *scene_obj = cJSON_CreateObject();
-        cJSON_AddStringToObject(scene_obj, "name", scenes[i].name);
-        cJSON_AddNumberToObject(scene_obj, "brightness", scenes[i].brightness);
-        cJSON_AddNumberToObject(scene_obj, "r", scenes[i].red);
-        cJSON_AddNumberToObject(scene_obj, "g", scenes[i].green);
-        cJSON_AddNumberToObject(scene_obj, "b", scenes[i].blue);
-        cJSON_AddNumberToObject(scene_obj, "w", scenes[i].white);
-        cJSON_AddItemToArray(scenes_array, scene_obj);
-    }
-    
-    cJSON_AddItemToObject(root, "scenes", scenes_array);
-    
-    char *json_str = cJSON_Print(root);
-    cJSON_Delete(root);
-    
-    if (!json_str) {
-        return ESP_FAIL;
-    }
+    memmove(&t->scenes[found_idx], &t->scenes[found_idx + 1],
+            (t->count - found_idx - 1) * sizeof(ui_scene_t));
+    t->count--;
+    name_index_rebuild(t);
     
-    FILE *file = fopen(SCENE_STORAGE_PATH, "w");
-    if (!file) {
-        free(json_str);
-        return ESP_FAIL;
+    esp_err_t ret = write_scenes_to_file(s_active->category, t->scenes, t->count);
+    if (ret != ESP_OK) {
+        // Reload from file to restore consistent state
+        scene_storage_load();
+        return ret;
     }
     
-    fwrite(json_str, 1, strlen(json_str), file);
-    fclose(file);
-    free(json_str);
-    
-    // Update cache
-    memcpy(s_scenes, scenes, count * sizeof(ui_scene_t));
-    s_scene_count = count;
-    
-    ESP_LOGI(TAG, "Scene '%s' deleted, remaining: %d", name, count);
+    ESP_LOGI(TAG, "Scene '%s' deleted, remaining: %d", name, (int)t->count);
     return ESP_OK;
 }
 
 /**
- * @brief Get the number of stored scenes
+ * @brief Get the number of scenes in the active category
  */
 size_t scene_storage_get_count(void)
 {
-    return s_scene_count;
+    return s_active->table.count;
 }
 
 /**
@@ -350,66 +627,41 @@ esp_err_t scene_storage_get_first(ui_scene_t *scene)
         return ESP_ERR_INVALID_ARG;
     }
     
-    if (s_scene_count == 0) {
+    // Always from the default category, which stays loaded in slot 0
+    const scene_table_t *t = &s_slots[0].table;
+    if (t->count == 0) {
         return ESP_ERR_NOT_FOUND;
     }
     
-    *scene = s_scenes[0];
+    *scene = t->scenes[0];
     return ESP_OK;
 }
 
 /**
- * @brief Reload scenes and update UI
+ * @brief Push cached scenes to the UI
+ *
+ * The cache is kept current by scene_storage_init() and every save, delete,
+ * update and reorder, so the file does not need to be parsed again here.
  */
 void scene_storage_reload_ui(void)
 {
-    ESP_LOGI(TAG, "scene_storage_reload_ui called");
-    
-    ui_scene_t scenes[SCENE_STORAGE_MAX_SCENES];
-    size_t count = 0;
-    
-    esp_err_t ret = scene_storage_load(scenes, SCENE_STORAGE_MAX_SCENES, &count);
-    ESP_LOGI(TAG, "scene_storage_load returned %s, count=%d", esp_err_to_name(ret), count);
-    
     // Lock LVGL before modifying UI (LVGL is not thread-safe)
     ui_lock();
-    
-    if (ret == ESP_OK) {
-        ESP_LOGI(TAG, "Calling ui_scenes_load_from_sd with %d scenes", count);
-        ui_scenes_load_from_sd(scenes, count);
-        ESP_LOGI(TAG, "UI updated with %d scenes", count);
-    } else {
-        ESP_LOGW(TAG, "Failed to reload scenes for UI: %s", esp_err_to_name(ret));
-        ui_scenes_load_from_sd(NULL, 0);
-    }
-    
+    scene_storage_reload_ui_no_lock();
     ui_unlock();
 }
 
 /**
- * @brief Reload scenes and update UI (no mutex - call from LVGL context only)
- * 
+ * @brief Push cached scenes to the UI (no mutex - call from LVGL context only)
+ *
  * Use this when already running inside an LVGL callback to avoid deadlock.
  */
 void scene_storage_reload_ui_no_lock(void)
 {
-    ESP_LOGI(TAG, "scene_storage_reload_ui_no_lock called");
-    
-    ui_scene_t scenes[SCENE_STORAGE_MAX_SCENES];
-    size_t count = 0;
-    
-    esp_err_t ret = scene_storage_load(scenes, SCENE_STORAGE_MAX_SCENES, &count);
-    ESP_LOGI(TAG, "scene_storage_load returned %s, count=%d", esp_err_to_name(ret), count);
-    
     // No lock - caller must already be in LVGL context
-    if (ret == ESP_OK) {
-        ESP_LOGI(TAG, "Calling ui_scenes_load_from_sd with %d scenes", count);
-        ui_scenes_load_from_sd(scenes, count);
-        ESP_LOGI(TAG, "UI updated with %d scenes", count);
-    } else {
-        ESP_LOGW(TAG, "Failed to reload scenes for UI: %s", esp_err_to_name(ret));
-        ui_scenes_load_from_sd(NULL, 0);
-    }
+    const scene_table_t *t = &s_active->table;
+    ui_scenes_load_from_sd(t->count > 0 ? t->scenes : NULL, t->count);
+    ESP_LOGI(TAG, "UI updated with %d scenes", (int)t->count);
 }
 
 /**
@@ -421,63 +673,190 @@ esp_err_t scene_storage_get_by_index(size_t index, ui_scene_t *scene)
         return ESP_ERR_INVALID_ARG;
     }
     
-    if (index >= s_scene_count) {
+    const scene_table_t *t = &s_active->table;
+    if (index >= t->count) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    *scene = s_scenes[index];
+    *scene = t->scenes[index];
     return ESP_OK;
 }
 
 /**
- * @brief Helper function to write scenes array to JSON file
+ * @brief Copy the default category as a scenes.bin image
  */
-static esp_err_t write_scenes_to_file(const ui_scene_t *scenes, size_t count)
+esp_err_t scene_storage_export_bin(uint8_t **out_image, size_t *out_size)
 {
-    cJSON *root = cJSON_CreateObject();
-    cJSON *scenes_array = cJSON_CreateArray();
+    if (!out_image || !out_size) {
+        return ESP_ERR_INVALID_ARG;
+    }
     
-    for (size_t i = 0; i < count; i++) {
-        cJSON *scene_obj = cJSON_CreateObject();
-        cJSON_AddStringToObject(scene_obj, "name", scenes[i].name);
-        cJSON_AddNumberToObject(scene_obj, "brightness", scenes[i].brightness);
-        cJSON_AddNumberToObject(scene_obj, "r", scenes[i].red);
-        cJSON_AddNumberToObject(scene_obj, "g", scenes[i].green);
-        cJSON_AddNumberToObject(scene_obj, "b", scenes[i].blue);
-        cJSON_AddNumberToObject(scene_obj, "w", scenes[i].white);
-        cJSON_AddItemToArray(scenes_array, scene_obj);
+    const scene_table_t *t = &s_slots[0].table;
+    size_t size = sizeof(scene_bin_header_t) + t->count * sizeof(scene_bin_record_t);
+    uint8_t *image = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!image) {
+        return ESP_ERR_NO_MEM;
+    }
+    
+    scene_bin_record_t *records = (scene_bin_record_t *)(image + sizeof(scene_bin_header_t));
+    for (size_t i = 0; i < t->count; i++) {
+        scene_bin_pack(&t->scenes[i], &records[i]);
     }
+    scene_bin_make_header((scene_bin_header_t *)image, records, t->count, NULL);
     
-    cJSON_AddNumberToObject(root, "version", 1);
-    cJSON_AddItemToObject(root, "scenes", scenes_array);
+    *out_image = image;
+    *out_size = size;
+    return ESP_OK;
+}
+
+/**
+ * @brief Replace the default category with a scenes.bin image
+ *
+ * The image is checked and written to SD card before the cached table is
+ * swapped, so a bad image or failed write leaves the library unchanged.
+ */
+esp_err_t scene_storage_import_bin(const uint8_t *image, size_t size)
+{
+    if (!image || size < sizeof(scene_bin_header_t)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
     
-    char *json_str = cJSON_Print(root);
-    cJSON_Delete(root);
+    const scene_bin_header_t *header = (const scene_bin_header_t *)image;
+    const scene_bin_record_t *records = (const scene_bin_record_t *)(image + sizeof(scene_bin_header_t));
+    if (header->count > SCENE_STORAGE_MAX_SCENES ||
+        size != sizeof(scene_bin_header_t) + header->count * sizeof(scene_bin_record_t)) {
+        ESP_LOGE(TAG, "Import: bad size %d for %d scenes", (int)size, (int)header->count);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (!scene_bin_verify(header, records)) {
+        ESP_LOGE(TAG, "Import: header or CRC invalid");
+        return ESP_ERR_INVALID_CRC;
+    }
     
-    if (!json_str) {
-        ESP_LOGE(TAG, "Failed to serialize JSON");
-        return ESP_FAIL;
+    scene_table_t t = {0};
+    if (table_reserve(&t, header->count) != ESP_OK) {
+        return ESP_ERR_NO_MEM;
     }
+    for (size_t i = 0; i < header->count; i++) {
+        scene_bin_unpack(&records[i], &t.scenes[i]);
+        if (t.scenes[i].name[0] == '\0') {
+            ESP_LOGE(TAG, "Import: scene %d has no name", (int)i);
+            table_free(&t);
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    t.count = header->count;
     
-    FILE *file = fopen(SCENE_STORAGE_PATH, "w");
+    // Names are unique within a category; the index makes the check O(n)
+    name_index_rebuild(&t);
+    for (size_t i = 0; i < t.count; i++) {
+        if (find_other_by_name(&t, t.scenes[i].name, (int)i) >= 0) {
+            ESP_LOGE(TAG, "Import: duplicate scene name '%s'", t.scenes[i].name);
+            table_free(&t);
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    
+    esp_err_t ret = write_scenes_to_file(0, t.scenes, t.count);
+    if (ret != ESP_OK) {
+        table_free(&t);
+        return ret;
+    }
+    
+    table_free(&s_slots[0].table);
+    s_slots[0].table = t;
+    
+    ESP_LOGI(TAG, "Imported %d scenes", (int)t.count);
+    return ESP_OK;
+}
+
+/**
+ * @brief Write a string as a JSON string literal (with quotes)
+ */
+static void write_json_string(FILE *file, const char *str)
+{
+    fputc('"', file);
+    for (const unsigned char *p = (const unsigned char *)str; *p; p++) {
+        switch (*p) {
+            case '"':  fputs("\\\"", file); break;
+            case '\\': fputs("\\\\", file); break;
+            case '\b': fputs("\\b", file); break;
+            case '\f': fputs("\\f", file); break;
+            case '\n': fputs("\\n", file); break;
+            case '\r': fputs("\\r", file); break;
+            case '\t': fputs("\\t", file); break;
+            default:
+                if (*p < 0x20) {
+                    fprintf(file, "\\u%04x", *p);
+                } else {
+                    fputc(*p, file);
+                }
+                break;
+        }
+    }
+    fputc('"', file);
+}
+
+/**
+ * @brief Helper function to write a category's JSON file (and its index)
+ *
+ * Scenes are written one at a time (same layout as cJSON_Print) so memory
+ * use does not grow with the size of the library.
+ */
+static esp_err_t write_scenes_to_file(size_t category, const ui_scene_t *scenes, size_t count)
+{
+    char json_path[CATEGORY_PATH_MAX];
+    char tmp_path[CATEGORY_PATH_MAX];
+    category_path(category, ".json", json_path, sizeof(json_path));
+    category_path(category, ".tmp", tmp_path, sizeof(tmp_path));
+    
+    FILE *file = fopen(tmp_path, "w");
     if (!file) {
-        ESP_LOGE(TAG, "Failed to open scenes.json for writing");
-        free(json_str);
+        ESP_LOGE(TAG, "Failed to open %s for writing", tmp_path);
         return ESP_FAIL;
     }
     
-    size_t json_len = strlen(json_str);
-    size_t written = fwrite(json_str, 1, json_len, file);
+    fputs("{\n\t\"version\":\t1,\n\t\"scenes\":\t[", file);
+    for (size_t i = 0; i < count; i++) {
+        fputs(i == 0 ? "{\n\t\t\t\"name\":\t" : ", {\n\t\t\t\"name\":\t", file);
+        write_json_string(file, scenes[i].name);
+        fprintf(file, ",\n\t\t\t\"brightness\":\t%d,\n\t\t\t\"r\":\t%d,\n\t\t\t\"g\":\t%d,"
+                      "\n\t\t\t\"b\":\t%d,\n\t\t\t\"w\":\t%d\n\t\t}",
+                scenes[i].brightness, scenes[i].red, scenes[i].green,
+                scenes[i].blue, scenes[i].white);
+    }
+    fputs("]\n}", file);
+    
     fflush(file);
+    bool write_error = ferror(file);
+    long json_len = ftell(file);
     fclose(file);
-    free(json_str);
     
-    if (written != json_len) {
-        ESP_LOGE(TAG, "Failed to write complete JSON (wrote %d of %d)", (int)written, (int)json_len);
+    if (write_error) {
+        ESP_LOGE(TAG, "Failed to write complete JSON");
+        remove(tmp_path);
         return ESP_FAIL;
     }
     
-    ESP_LOGI(TAG, "Wrote %d bytes to %s", (int)json_len, SCENE_STORAGE_PATH);
+    // FAT rename does not replace; if power fails in between, load picks up the .tmp
+    remove(json_path);
+    if (rename(tmp_path, json_path) != 0) {
+        ESP_LOGE(TAG, "Failed to rename %s to %s", tmp_path, json_path);
+        return ESP_FAIL;
+    }
+    
+    ESP_LOGI(TAG, "Wrote %ld bytes to %s", json_len, json_path);
+    
+#if CONFIG_SCENE_BINARY_INDEX
+    // Keep the binary index in step with the JSON just written
+    char bin_path[CATEGORY_PATH_MAX];
+    category_path(category, ".bin", bin_path, sizeof(bin_path));
+    struct stat st;
+    if (stat(json_path, &st) != 0 || scene_bin_write(bin_path, &st, scenes, count) != ESP_OK) {
+        scene_bin_invalidate(bin_path);
+    }
+#endif
+    
     return ESP_OK;
 }
 
@@ -492,36 +871,39 @@ esp_err_t scene_storage_update(size_t index, const char *new_name,
         return ESP_ERR_INVALID_ARG;
     }
     
-    if (index >= s_scene_count) {
-        ESP_LOGE(TAG, "Invalid scene index %d (count=%d)", (int)index, (int)s_scene_count);
+    scene_table_t *t = &s_active->table;
+    
+    if (index >= t->count) {
+        ESP_LOGE(TAG, "Invalid scene index %d (count=%d)", (int)index, (int)t->count);
         return ESP_ERR_INVALID_ARG;
     }
     
     // Check if new name conflicts with another scene (not this one)
-    for (size_t i = 0; i < s_scene_count; i++) {
-        if (i != index && strcmp(s_scenes[i].name, new_name) == 0) {
-            ESP_LOGE(TAG, "Scene name '%s' already exists at index %d", new_name, (int)i);
-            return ESP_ERR_INVALID_STATE;
-        }
+    int existing_idx = find_other_by_name(t, new_name, (int)index);
+    if (existing_idx >= 0) {
+        ESP_LOGE(TAG, "Scene name '%s' already exists at index %d", new_name, existing_idx);
+        return ESP_ERR_INVALID_STATE;
     }
     
     ESP_LOGI(TAG, "Updating scene at index %d: '%s' -> '%s', B=%d R=%d G=%d B=%d W=%d",
-             (int)index, s_scenes[index].name, new_name, brightness, red, green, blue, white);
+             (int)index, t->scenes[index].name, new_name, brightness, red, green, blue, white);
     
     // Update in cache
-    strncpy(s_scenes[index].name, new_name, sizeof(s_scenes[index].name) - 1);
-    s_scenes[index].name[sizeof(s_scenes[index].name) - 1] = '\0';
-    s_scenes[index].brightness = brightness;
-    s_scenes[index].red = red;
-    s_scenes[index].green = green;
-    s_scenes[index].blue = blue;
-    s_scenes[index].white = white;
+    ui_scene_t *scene = &t->scenes[index];
+    strncpy(scene->name, new_name, sizeof(scene->name) - 1);
+    scene->name[sizeof(scene->name) - 1] = '\0';
+    scene->brightness = brightness;
+    scene->red = red;
+    scene->green = green;
+    scene->blue = blue;
+    scene->white = white;
+    name_index_rebuild(t);
     
     // Write to file
-    esp_err_t ret = write_scenes_to_file(s_scenes, s_scene_count);
+    esp_err_t ret = write_scenes_to_file(s_active->category, t->scenes, t->count);
     if (ret != ESP_OK) {
         // Reload from file to restore consistent state
-        scene_storage_load(s_scenes, SCENE_STORAGE_MAX_SCENES, &s_scene_count);
+        scene_storage_load();
         return ret;
     }
     
@@ -534,9 +916,11 @@ esp_err_t scene_storage_update(size_t index, const char *new_name,
  */
 esp_err_t scene_storage_reorder(size_t from_index, size_t to_index)
 {
-    if (from_index >= s_scene_count || to_index >= s_scene_count) {
+    scene_table_t *t = &s_active->table;
+    
+    if (from_index >= t->count || to_index >= t->count) {
         ESP_LOGE(TAG, "Invalid reorder indices: from=%d, to=%d (count=%d)",
-                 (int)from_index, (int)to_index, (int)s_scene_count);
+                 (int)from_index, (int)to_index, (int)t->count);
         return ESP_ERR_INVALID_ARG;
     }
     
@@ -547,28 +931,27 @@ esp_err_t scene_storage_reorder(size_t from_index, size_t to_index)
     ESP_LOGI(TAG, "Reordering scene from index %d to %d", (int)from_index, (int)to_index);
     
     // Save the scene being moved
-    ui_scene_t moving_scene = s_scenes[from_index];
+    ui_scene_t moving_scene = t->scenes[from_index];
     
     if (from_index < to_index) {
         // Moving forward: shift items left
-        for (size_t i = from_index; i < to_index; i++) {
-            s_scenes[i] = s_scenes[i + 1];
-        }
+        memmove(&t->scenes[from_index], &t->scenes[from_index + 1],
+                (to_index - from_index) * sizeof(ui_scene_t));
     } else {
         // Moving backward: shift items right
-        for (size_t i = from_index; i > to_index; i--) {
-            s_scenes[i] = s_scenes[i - 1];
-        }
+        memmove(&t->scenes[to_index + 1], &t->scenes[to_index],
+                (from_index - to_index) * sizeof(ui_scene_t));
     }
     
     // Place the scene at new position
-    s_scenes[to_index] = moving_scene;
+    t->scenes[to_index] = moving_scene;
+    name_index_rebuild(t);
     
     // Write to file
-    esp_err_t ret = write_scenes_to_file(s_scenes, s_scene_count);
+    esp_err_t ret = write_scenes_to_file(s_active->category, t->scenes, t->count);
     if (ret != ESP_OK) {
         // Reload from file to restore consistent state
-        scene_storage_load(s_scenes, SCENE_STORAGE_MAX_SCENES, &s_scene_count);
+        scene_storage_load();
         return ret;
     }
     
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "esp_err.h"
+#include "sdkconfig.h"
 #include "../ui/ui_common.h"
 #include <stdint.h>
 #include <stddef.h>
@@ -14,31 +15,81 @@
 extern "C" {
 #endif
 
-#define SCENE_STORAGE_MAX_SCENES    32
+/**
+ * @brief Upper bound on the number of scenes
+ *
+ * The scene table lives in PSRAM and grows on demand; this only caps it.
+ */
+#define SCENE_STORAGE_MAX_SCENES    CONFIG_SCENE_STORAGE_MAX_SCENES
 #define SCENE_STORAGE_PATH          "/sdcard/scenes.json"
 
+/// Directory holding one <category>.json per additional category
+#define SCENE_STORAGE_CATEGORY_DIR      "/sdcard/scenes"
+/// Display name of the category stored in scenes.json
+#define SCENE_STORAGE_DEFAULT_CATEGORY  "Scenes"
+#define SCENE_STORAGE_CATEGORY_NAME_LEN 32
+#define SCENE_STORAGE_MAX_CATEGORIES    CONFIG_SCENE_STORAGE_MAX_CATEGORIES
+/// Number of categories kept loaded (LRU), including the default category
+#define SCENE_STORAGE_CATEGORY_CACHE    CONFIG_SCENE_STORAGE_CATEGORY_CACHE
+
 /**
  * @brief Initialize scene storage module
  * 
+ * Lists the scene categories and loads the default category (scenes.json),
+ * which becomes the active category. Other categories are not read until
+ * opened. Call once at boot before scene_storage_reload_ui().
+ * 
  * @return esp_err_t ESP_OK on success
  */
 esp_err_t scene_storage_init(void);
 
 /**
- * @brief Load scenes from SD card
+ * @brief Reload the active category from SD card
+ * 
+ * Uses the category's binary index when it matches its JSON file, otherwise
+ * streams the JSON through scene_json_parse_file(). The category is empty
+ * if loading fails.
  * 
- * @param scenes Output array to store loaded scenes
- * @param max_count Maximum number of scenes to load
- * @param out_count Output: actual number of scenes loaded
  * @return esp_err_t ESP_OK on success
  */
-esp_err_t scene_storage_load(ui_scene_t *scenes, size_t max_count, size_t *out_count);
+esp_err_t scene_storage_load(void);
+
+/**
+ * @brief Get the number of scene categories (at least 1)
+ */
+size_t scene_storage_get_category_count(void);
+
+/**
+ * @brief Get a category's display name
+ * 
+ * @param index Category index; 0 is the default category (scenes.json)
+ * @return Name, or NULL if index is invalid
+ */
+const char *scene_storage_get_category_name(size_t index);
+
+/**
+ * @brief Get the index of the active category
+ */
+size_t scene_storage_get_active_category(void);
+
+/**
+ * @brief Make a category active
+ * 
+ * Loads the category from SD card unless it is in the LRU cache. All other
+ * scene_storage functions (except scene_storage_get_first()) then operate
+ * on this category. Call scene_storage_reload_ui() afterwards to show it.
+ * 
+ * @param index Category index
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_ARG if index invalid
+ */
+esp_err_t scene_storage_open_category(size_t index);
 
 /**
  * @brief Save a new scene to SD card
  * 
- * Appends the scene to the existing scenes.json file.
- * If a scene with the same name exists, it will be updated.
+ * Adds the scene to the active category, or updates the scene with the
+ * same name. The category's JSON file is rewritten through a .tmp file and
+ * a rename. Its binary index is regenerated with CONFIG_SCENE_BINARY_INDEX.
  * 
  * @param name Scene name
  * @param brightness Brightness value (0-255)
@@ -60,14 +111,14 @@ esp_err_t scene_storage_save(const char *name, uint8_t brightness,
 esp_err_t scene_storage_delete(const char *name);
 
 /**
- * @brief Get the number of stored scenes
+ * @brief Get the number of scenes in the active category
  * 
  * @return size_t Number of scenes
  */
 size_t scene_storage_get_count(void);
 
 /**
- * @brief Get the first scene (for auto-apply on boot)
+ * @brief Get the first scene of the default category (for auto-apply on boot)
  * 
  * @param scene Output: the first scene
  * @return esp_err_t ESP_OK on success, ESP_ERR_NOT_FOUND if no scenes
@@ -77,7 +128,8 @@ esp_err_t scene_storage_get_first(ui_scene_t *scene);
 /**
  * @brief Reload scenes and update UI
  * 
- * Convenience function to reload scenes from SD and update the scene list UI
+ * Convenience function to update the scene list UI from the scene cache.
+ * Does not re-read the SD card; the cache is kept current by every write.
  */
 void scene_storage_reload_ui(void);
 
@@ -123,6 +175,33 @@ esp_err_t scene_storage_reorder(size_t from_index, size_t to_index);
  */
 esp_err_t scene_storage_get_by_index(size_t index, ui_scene_t *scene);
 
+/**
+ * @brief Copy the default category as a scenes.bin image (bulk export)
+ * 
+ * The image is the scenes.bin layout from scene_bin.h with source_mtime and
+ * source_size set to zero. Call with ui_lock() held from non-UI tasks.
+ * 
+ * @param out_image Output: PSRAM buffer, free with heap_caps_free()
+ * @param out_size Output: image size in bytes
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NO_MEM
+ */
+esp_err_t scene_storage_export_bin(uint8_t **out_image, size_t *out_size);
+
+/**
+ * @brief Replace the default category with a scenes.bin image (bulk import)
+ * 
+ * All-or-nothing: the image CRC is verified and scenes.json rewritten before
+ * the cache is replaced. Call with ui_lock() held from non-UI tasks, then
+ * scene_storage_reload_ui_no_lock() to show the result.
+ * 
+ * @param image Header followed by header.count records
+ * @param size Image size in bytes
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_SIZE or
+ *                   ESP_ERR_INVALID_CRC if the image is malformed,
+ *                   ESP_ERR_INVALID_ARG for an empty or duplicate name
+ */
+esp_err_t scene_storage_import_bin(const uint8_t *image, size_t size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -4,17 +4,28 @@
  * 
  * Implements automatic screen timeout with touch-to-wake functionality
  * for power saving when the device is idle. Features a smooth 1-second
- * fade-to-black transition before turning off the backlight.
+ * fade-to-black transition before turning off the backlight: by dimming
+ * the backlight when it is PWM-driven, otherwise by a black LVGL overlay
+ * (or no fade at all if CONFIG_SCREEN_FADE_OVERLAY is disabled).
+ * 
+ * Event driven: touch activity only stores a timestamp. A one-shot
+ * esp_timer fires at the deadline, and every state transition runs in
+ * LVGL context (ui_async_call()), so nothing polls the module.
  */
 
 #include "screen_timeout.h"
 #include "esp_log.h"
+#include "esp_check.h"
 #include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
-#include "freertos/semphr.h"
 #include "lvgl.h"
+#include <stdatomic.h>
 #include "ui/ui_common.h"
 
+#if CONFIG_SCREEN_BACKLIGHT_PWM
+#include "driver/ledc.h"
+#endif
+
 static const char *TAG = "screen_timeout";
 
 /// Fade animation duration in milliseconds
@@ -25,6 +36,28 @@ static const char *TAG = "screen_timeout";
 /// At 60fps, 1000ms = 60 frames. 20 steps = opacity change every 3 frames
 #define FADE_OPACITY_STEPS  20
 
+/// Deadline timer retry when the LVGL call queue is full
+#define ASYNC_RETRY_MS      100
+
+#if CONFIG_SCREEN_BACKLIGHT_PWM
+#define FADE_TIME_MS        FADE_DURATION_MS
+#define FADE_MODE_NAME      "backlight PWM"
+#elif CONFIG_SCREEN_FADE_OVERLAY
+#define FADE_TIME_MS        FADE_DURATION_MS
+#define FADE_MODE_NAME      "overlay"
+#else
+#define FADE_TIME_MS        0       ///< Backlight switches on the next LVGL timer run
+#define FADE_MODE_NAME      "none"
+#endif
+
+#if CONFIG_SCREEN_BACKLIGHT_PWM
+#define BACKLIGHT_LEDC_MODE         LEDC_LOW_SPEED_MODE
+#define BACKLIGHT_LEDC_TIMER        LEDC_TIMER_0
+#define BACKLIGHT_LEDC_CHANNEL      LEDC_CHANNEL_0
+#define BACKLIGHT_LEDC_RESOLUTION   LEDC_TIMER_10_BIT
+#define BACKLIGHT_DUTY_MAX          ((1 << 10) - 1)
+#endif
+
 /// Screen state machine
 typedef enum {
     SCREEN_STATE_ACTIVE,        ///< Screen is on and active
@@ -38,27 +71,109 @@ static void fade_out_complete_cb(lv_anim_t *anim);
 static void fade_in_complete_cb(lv_anim_t *anim);
 
 /// Module state
+/// state, fade_* and pending_wake are only written in LVGL context
 static struct {
     ch422g_handle_t ch422g;         ///< CH422G handle for backlight control
-    uint16_t timeout_sec;           ///< Timeout duration (0 = disabled)
-    int64_t last_activity_us;       ///< Timestamp of last activity (microseconds)
-    screen_state_t state;           ///< Current screen state
+    volatile uint16_t timeout_sec;  ///< Timeout duration (0 = disabled)
+    volatile uint32_t last_activity_ms; ///< Time of last activity (esp_timer ms, wraps)
+    volatile screen_state_t state;  ///< Current screen state
     bool initialized;               ///< Module initialized flag
-    SemaphoreHandle_t mutex;        ///< Thread safety mutex
-    lv_obj_t *fade_overlay;         ///< Black overlay for fade effect
+    esp_timer_handle_t deadline_timer;  ///< One-shot timer at the timeout deadline
+    atomic_bool wake_queued;        ///< A wake is queued for LVGL context
+    atomic_bool sleep_retry;        ///< Manual sleep waiting for the call queue
+    lv_obj_t *fade_overlay;         ///< Black overlay for fade effect (overlay fade only)
+    lv_opa_t fade_opa;              ///< Overlay opacity last applied
+    uint32_t fade_redraws;          ///< Full-screen redraws caused by the current fade
     lv_anim_t fade_anim;            ///< Fade animation
     bool pending_wake;              ///< Touch occurred during fade-out or when off
 } s_state = {
     .ch422g = NULL,
     .timeout_sec = SCREEN_TIMEOUT_DEFAULT_SEC,
-    .last_activity_us = 0,
+    .last_activity_ms = 0,
     .state = SCREEN_STATE_ACTIVE,
     .initialized = false,
-    .mutex = NULL,
+    .deadline_timer = NULL,
     .fade_overlay = NULL,
     .pending_wake = false,
 };
 
+static uint32_t now_ms(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+/**
+ * @brief (Re)start the deadline timer
+ * 
+ * @param delay_ms Time until the timer fires
+ */
+static void deadline_arm(uint32_t delay_ms)
+{
+    esp_timer_stop(s_state.deadline_timer);    // Not running is fine
+    esp_timer_start_once(s_state.deadline_timer, (uint64_t)delay_ms * 1000);
+}
+
+/**
+ * @brief Arm the deadline for the full timeout from the last activity
+ */
+static void deadline_arm_from_activity(void)
+{
+    uint32_t timeout_ms = (uint32_t)s_state.timeout_sec * 1000;
+    if (timeout_ms == 0) {
+        esp_timer_stop(s_state.deadline_timer);
+        return;
+    }
+
+    uint32_t idle_ms = now_ms() - s_state.last_activity_ms;
+    deadline_arm(idle_ms < timeout_ms ? timeout_ms - idle_ms : 0);
+}
+
+#if CONFIG_SCREEN_BACKLIGHT_PWM
+/**
+ * @brief Configure LEDC on the backlight GPIO, at full brightness
+ */
+static esp_err_t backlight_pwm_init(void)
+{
+    ledc_timer_config_t timer_cfg = {
+        .speed_mode = BACKLIGHT_LEDC_MODE,
+        .duty_resolution = BACKLIGHT_LEDC_RESOLUTION,
+        .timer_num = BACKLIGHT_LEDC_TIMER,
+        .freq_hz = CONFIG_SCREEN_BACKLIGHT_PWM_FREQ_HZ,
+        .clk_cfg = LEDC_AUTO_CLK,
+    };
+    ESP_RETURN_ON_ERROR(ledc_timer_config(&timer_cfg), TAG, "Failed to configure LEDC timer");
+
+    ledc_channel_config_t channel_cfg = {
+        .gpio_num = CONFIG_SCREEN_BACKLIGHT_PWM_GPIO,
+        .speed_mode = BACKLIGHT_LEDC_MODE,
+        .channel = BACKLIGHT_LEDC_CHANNEL,
+        .timer_sel = BACKLIGHT_LEDC_TIMER,
+        .duty = BACKLIGHT_DUTY_MAX,
+        .hpoint = 0,
+    };
+    ESP_RETURN_ON_ERROR(ledc_channel_config(&channel_cfg), TAG, "Failed to configure LEDC channel");
+
+    ESP_LOGI(TAG, "PWM backlight on GPIO%d at %d Hz",
+             CONFIG_SCREEN_BACKLIGHT_PWM_GPIO, CONFIG_SCREEN_BACKLIGHT_PWM_FREQ_HZ);
+    return ESP_OK;
+}
+
+/**
+ * @brief Set backlight brightness
+ * 
+ * The duty cycle follows the square of the level, so a linear fade looks
+ * even to the eye.
+ * 
+ * @param level 0 (dark) to 255 (full)
+ */
+static void backlight_set_level(uint8_t level)
+{
+    uint32_t duty = (uint32_t)level * level * BACKLIGHT_DUTY_MAX / (255 * 255);
+    ledc_set_duty(BACKLIGHT_LEDC_MODE, BACKLIGHT_LEDC_CHANNEL, duty);
+    ledc_update_duty(BACKLIGHT_LEDC_MODE, BACKLIGHT_LEDC_CHANNEL);
+}
+#endif
+
 /**
  * @brief Turn backlight on via CH422G
  */
@@ -75,6 +190,10 @@ static esp_err_t backlight_on(void)
  */
 static esp_err_t backlight_off(void)
 {
+#if CONFIG_SCREEN_BACKLIGHT_PWM
+    // Also holds the panel dark if an SD access re-enables the CH422G output
+    backlight_set_level(0);
+#endif
     if (s_state.ch422g == NULL) {
         return ESP_ERR_INVALID_STATE;
     }
@@ -82,30 +201,95 @@ static esp_err_t backlight_off(void)
 }
 
 /**
- * @brief Animation callback - sets overlay opacity using stepped values
- * Uses discrete steps to reduce banding artifacts caused by mid-frame opacity changes.
- * The stepped approach ensures opacity only changes at specific intervals,
- * giving the display time to complete full frames at each opacity level.
+ * @brief Animation callback - applies one fade level
+ * 
+ * @param var Unused (&s_state)
+ * @param value Darkness, LV_OPA_TRANSP (screen fully visible) to LV_OPA_COVER (black)
+ * 
+ * With a PWM backlight the level goes to the LEDC duty and nothing is
+ * redrawn. With the overlay, the opacity uses discrete steps to reduce
+ * banding artifacts caused by mid-frame opacity changes, and is only set
+ * when the step changes: every change redraws the whole screen.
  */
-static void fade_anim_cb(void *obj, int32_t value)
+static void fade_anim_cb(void *var, int32_t value)
 {
+#if CONFIG_SCREEN_BACKLIGHT_PWM
+    backlight_set_level(LV_OPA_COVER - value);
+#elif CONFIG_SCREEN_FADE_OVERLAY
     if (s_state.fade_overlay != NULL) {
         // Quantize to discrete steps to reduce banding
         // This ensures opacity changes happen less frequently, allowing
         // complete frames to render at each opacity level
         int step = (value * FADE_OPACITY_STEPS) / LV_OPA_COVER;
         lv_opa_t stepped_opa = (step * LV_OPA_COVER) / FADE_OPACITY_STEPS;
-        lv_obj_set_style_bg_opa(s_state.fade_overlay, stepped_opa, 0);
+        if (stepped_opa != s_state.fade_opa) {
+            lv_obj_set_style_bg_opa(s_state.fade_overlay, stepped_opa, 0);
+            s_state.fade_opa = stepped_opa;
+            s_state.fade_redraws++;
+        }
+    }
+#endif
+}
+
+/**
+ * @brief Show the overlay at an opacity (overlay fade only)
+ */
+static void fade_overlay_show(lv_opa_t opa)
+{
+#if CONFIG_SCREEN_FADE_OVERLAY
+    lv_obj_clear_flag(s_state.fade_overlay, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_set_style_bg_opa(s_state.fade_overlay, opa, 0);
+    s_state.fade_opa = opa;
+#endif
+}
+
+/**
+ * @brief Hide the overlay once it is fully opaque or transparent
+ */
+static void fade_overlay_hide(void)
+{
+    if (s_state.fade_overlay != NULL) {
+        lv_obj_add_flag(s_state.fade_overlay, LV_OBJ_FLAG_HIDDEN);
     }
 }
 
+/**
+ * @brief Start the fade animation between two darkness values
+ */
+static void fade_anim_start(int32_t from, int32_t to, lv_anim_ready_cb_t ready_cb)
+{
+    s_state.fade_redraws = 0;
+
+    lv_anim_init(&s_state.fade_anim);
+    lv_anim_set_var(&s_state.fade_anim, &s_state);
+    lv_anim_set_exec_cb(&s_state.fade_anim, fade_anim_cb);
+    lv_anim_set_values(&s_state.fade_anim, from, to);
+    lv_anim_set_time(&s_state.fade_anim, FADE_TIME_MS);
+    lv_anim_set_ready_cb(&s_state.fade_anim, ready_cb);
+    lv_anim_start(&s_state.fade_anim);
+}
+
+/**
+ * @brief Log what a finished fade cost in rendering
+ * 
+ * Each overlay step redraws and blends the whole screen into a PSRAM
+ * framebuffer; a backlight fade redraws nothing.
+ */
+static void fade_log_cost(const char *name)
+{
+    uint32_t frame_kb = (uint32_t)lv_disp_get_hor_res(NULL) * lv_disp_get_ver_res(NULL) *
+                        sizeof(lv_color_t) / 1024;
+    ESP_LOGI(TAG, "%s complete: %u full-screen redraws (~%u KB framebuffer writes)",
+             name, (unsigned)s_state.fade_redraws, (unsigned)(s_state.fade_redraws * frame_kb));
+}
+
 /**
  * @brief Fade-out complete callback
  * Called from LVGL context when fade-out animation finishes
  */
 static void fade_out_complete_cb(lv_anim_t *anim)
 {
-    ESP_LOGI(TAG, "Fade-out complete, turning off backlight");
+    fade_log_cost("Fade-out");
     
     // Check if a wake was requested during the fade
     if (s_state.pending_wake) {
@@ -113,25 +297,18 @@ static void fade_out_complete_cb(lv_anim_t *anim)
         ESP_LOGI(TAG, "Wake requested during fade-out, waking immediately");
         // Start fade-in instead
         s_state.state = SCREEN_STATE_FADING_IN;
-        
-        lv_anim_init(&s_state.fade_anim);
-        lv_anim_set_var(&s_state.fade_anim, s_state.fade_overlay);
-        lv_anim_set_exec_cb(&s_state.fade_anim, fade_anim_cb);
-        lv_anim_set_values(&s_state.fade_anim, LV_OPA_COVER, LV_OPA_TRANSP);
-        lv_anim_set_time(&s_state.fade_anim, FADE_DURATION_MS);
-        lv_anim_set_ready_cb(&s_state.fade_anim, fade_in_complete_cb);
-        lv_anim_start(&s_state.fade_anim);
+        fade_anim_start(LV_OPA_COVER, LV_OPA_TRANSP, fade_in_complete_cb);
         return;
     }
     
     // Turn off backlight
+    ESP_LOGI(TAG, "Turning off backlight");
     backlight_off();
     s_state.state = SCREEN_STATE_OFF;
+    ui_set_screen_off_no_lock(true);
     
     // Hide overlay (it's fully opaque now, but hidden saves resources)
-    if (s_state.fade_overlay != NULL) {
-        lv_obj_add_flag(s_state.fade_overlay, LV_OBJ_FLAG_HIDDEN);
-    }
+    fade_overlay_hide();
 }
 
 /**
@@ -140,13 +317,12 @@ static void fade_out_complete_cb(lv_anim_t *anim)
  */
 static void fade_in_complete_cb(lv_anim_t *anim)
 {
-    ESP_LOGI(TAG, "Fade-in complete");
+    fade_log_cost("Fade-in");
     s_state.state = SCREEN_STATE_ACTIVE;
+    deadline_arm_from_activity();
     
     // Hide the fully transparent overlay
-    if (s_state.fade_overlay != NULL) {
-        lv_obj_add_flag(s_state.fade_overlay, LV_OBJ_FLAG_HIDDEN);
-    }
+    fade_overlay_hide();
 }
 
 /**
@@ -154,6 +330,7 @@ static void fade_in_complete_cb(lv_anim_t *anim)
  */
 static void create_fade_overlay(void)
 {
+#if CONFIG_SCREEN_FADE_OVERLAY
     if (s_state.fade_overlay != NULL) {
         return;  // Already created
     }
@@ -170,6 +347,7 @@ static void create_fade_overlay(void)
     lv_obj_add_flag(s_state.fade_overlay, LV_OBJ_FLAG_HIDDEN);
     
     ESP_LOGI(TAG, "Fade overlay created");
+#endif
 }
 
 /**
@@ -177,25 +355,15 @@ static void create_fade_overlay(void)
  */
 static void start_fade_out(void)
 {
-    if (s_state.fade_overlay == NULL) {
-        create_fade_overlay();
-    }
+    create_fade_overlay();
     
     ESP_LOGI(TAG, "Starting fade-out animation");
     s_state.state = SCREEN_STATE_FADING_OUT;
     s_state.pending_wake = false;
     
     // Show overlay and start animation
-    lv_obj_clear_flag(s_state.fade_overlay, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_set_style_bg_opa(s_state.fade_overlay, LV_OPA_TRANSP, 0);
-    
-    lv_anim_init(&s_state.fade_anim);
-    lv_anim_set_var(&s_state.fade_anim, s_state.fade_overlay);
-    lv_anim_set_exec_cb(&s_state.fade_anim, fade_anim_cb);
-    lv_anim_set_values(&s_state.fade_anim, LV_OPA_TRANSP, LV_OPA_COVER);
-    lv_anim_set_time(&s_state.fade_anim, FADE_DURATION_MS);
-    lv_anim_set_ready_cb(&s_state.fade_anim, fade_out_complete_cb);
-    lv_anim_start(&s_state.fade_anim);
+    fade_overlay_show(LV_OPA_TRANSP);
+    fade_anim_start(LV_OPA_TRANSP, LV_OPA_COVER, fade_out_complete_cb);
 }
 
 /**
@@ -203,27 +371,123 @@ static void start_fade_out(void)
  */
 static void start_fade_in(void)
 {
-    if (s_state.fade_overlay == NULL) {
-        create_fade_overlay();
-    }
+    create_fade_overlay();
     
     ESP_LOGI(TAG, "Starting fade-in animation");
     s_state.state = SCREEN_STATE_FADING_IN;
     
-    // Ensure backlight is on
+    // Show overlay at full opacity (or hold the PWM dark), then enable the backlight
+    fade_overlay_show(LV_OPA_COVER);
     backlight_on();
+    ui_set_screen_off_no_lock(false);
     
-    // Show overlay at full opacity and fade out
-    lv_obj_clear_flag(s_state.fade_overlay, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_set_style_bg_opa(s_state.fade_overlay, LV_OPA_COVER, 0);
-    
-    lv_anim_init(&s_state.fade_anim);
-    lv_anim_set_var(&s_state.fade_anim, s_state.fade_overlay);
-    lv_anim_set_exec_cb(&s_state.fade_anim, fade_anim_cb);
-    lv_anim_set_values(&s_state.fade_anim, LV_OPA_COVER, LV_OPA_TRANSP);
-    lv_anim_set_time(&s_state.fade_anim, FADE_DURATION_MS);
-    lv_anim_set_ready_cb(&s_state.fade_anim, fade_in_complete_cb);
-    lv_anim_start(&s_state.fade_anim);
+    fade_anim_start(LV_OPA_COVER, LV_OPA_TRANSP, fade_in_complete_cb);
+}
+
+/**
+ * @brief Timeout reached (LVGL context, queued by the deadline timer)
+ * 
+ * Activity since the timer was armed moves the deadline instead.
+ */
+static void timeout_async_cb(void *arg)
+{
+    if (s_state.state != SCREEN_STATE_ACTIVE) {
+        return;     // Re-armed when the fade-in completes
+    }
+
+    uint32_t timeout_ms = (uint32_t)s_state.timeout_sec * 1000;
+    uint32_t idle_ms = now_ms() - s_state.last_activity_ms;
+    if (timeout_ms == 0 || idle_ms < timeout_ms) {
+        deadline_arm_from_activity();
+        return;
+    }
+
+    ESP_LOGI(TAG, "Timeout elapsed (%u sec) - starting fade-out", s_state.timeout_sec);
+    start_fade_out();
+}
+
+/**
+ * @brief Manual sleep (LVGL context)
+ */
+static void sleep_async_cb(void *arg)
+{
+    if (s_state.state == SCREEN_STATE_ACTIVE) {
+        ESP_LOGI(TAG, "Manual sleep - starting fade-out");
+        start_fade_out();
+    }
+}
+
+/**
+ * @brief Wake requested (LVGL context)
+ */
+static void wake_async_cb(void *arg)
+{
+    atomic_store(&s_state.wake_queued, false);
+
+    switch (s_state.state) {
+        case SCREEN_STATE_OFF:
+            ESP_LOGI(TAG, "Activity detected - waking screen");
+            start_fade_in();
+            break;
+
+        case SCREEN_STATE_FADING_OUT:
+            // fade_out_complete_cb() turns this into a fade-in
+            ESP_LOGI(TAG, "Activity during fade-out - will wake");
+            s_state.pending_wake = true;
+            break;
+
+        case SCREEN_STATE_FADING_IN:
+        case SCREEN_STATE_ACTIVE:
+            break;
+    }
+}
+
+/**
+ * @brief Queue a wake unless one is already queued (any task)
+ */
+static void request_wake(void)
+{
+    if (!atomic_exchange(&s_state.wake_queued, true)) {
+        if (!ui_async_call(wake_async_cb, NULL)) {
+            atomic_store(&s_state.wake_queued, false);
+        }
+    }
+}
+
+/**
+ * @brief Deadline timer callback (esp_timer task)
+ * 
+ * Touches do not move the timer, so it usually fires early: it then
+ * re-arms itself for the rest of the timeout, counted from the last
+ * activity. Only a real timeout reaches LVGL context. If the LVGL call
+ * queue is full, the timer retries after ASYNC_RETRY_MS; it also retries
+ * a manual sleep that could not be queued.
+ */
+static void deadline_timer_cb(void *arg)
+{
+    if (atomic_load(&s_state.sleep_retry)) {
+        if (ui_async_call(sleep_async_cb, NULL)) {
+            atomic_store(&s_state.sleep_retry, false);
+        } else {
+            deadline_arm(ASYNC_RETRY_MS);
+        }
+        return;
+    }
+
+    if (s_state.state != SCREEN_STATE_ACTIVE || s_state.timeout_sec == 0) {
+        return;
+    }
+
+    uint32_t timeout_ms = (uint32_t)s_state.timeout_sec * 1000;
+    uint32_t idle_ms = now_ms() - s_state.last_activity_ms;
+    if (idle_ms < timeout_ms) {
+        deadline_arm(timeout_ms - idle_ms);
+        return;
+    }
+
+    if (!ui_async_call(timeout_async_cb, NULL)) {
+        deadline_arm(ASYNC_RETRY_MS);
+    }
 }
 
 esp_err_t screen_timeout_init(const screen_timeout_config_t *config)
@@ -237,19 +501,31 @@ esp_err_t screen_timeout_init(const screen_timeout_config_t *config)
         return ESP_OK;
     }
     
-    s_state.mutex = xSemaphoreCreateMutex();
-    if (s_state.mutex == NULL) {
-        ESP_LOGE(TAG, "Failed to create mutex");
+#if CONFIG_SCREEN_BACKLIGHT_PWM
+    esp_err_t ret = backlight_pwm_init();
+    if (ret != ESP_OK) {
+        return ret;
+    }
+#endif
+    
+    const esp_timer_create_args_t timer_args = {
+        .callback = deadline_timer_cb,
+        .name = "screen_timeout",
+    };
+    if (esp_timer_create(&timer_args, &s_state.deadline_timer) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create deadline timer");
         return ESP_ERR_NO_MEM;
     }
     
     s_state.ch422g = config->ch422g_handle;
     s_state.timeout_sec = config->timeout_sec;
-    s_state.last_activity_us = esp_timer_get_time();
+    s_state.last_activity_ms = now_ms();
     s_state.state = SCREEN_STATE_ACTIVE;
     s_state.initialized = true;
     s_state.fade_overlay = NULL;
     s_state.pending_wake = false;
+    atomic_store(&s_state.wake_queued, false);
+    atomic_store(&s_state.sleep_retry, false);
     
     // Create overlay in LVGL context
     if (ui_lock()) {
@@ -257,8 +533,10 @@ esp_err_t screen_timeout_init(const screen_timeout_config_t *config)
         ui_unlock();
     }
     
-    ESP_LOGI(TAG, "Initialized with timeout=%u sec (0=disabled), fade=%dms", 
-             s_state.timeout_sec, FADE_DURATION_MS);
+    deadline_arm_from_activity();
+    
+    ESP_LOGI(TAG, "Initialized with timeout=%u sec (0=disabled), fade=%dms (%s)", 
+             s_state.timeout_sec, FADE_TIME_MS, FADE_MODE_NAME);
     
     return ESP_OK;
 }
@@ -269,22 +547,21 @@ void screen_timeout_deinit(void)
         return;
     }
     
+    s_state.initialized = false;
+    esp_timer_stop(s_state.deadline_timer);
+    esp_timer_delete(s_state.deadline_timer);
+    s_state.deadline_timer = NULL;
+    
     // Delete overlay in LVGL context
     if (ui_lock()) {
+        lv_anim_del(&s_state, NULL);
         if (s_state.fade_overlay != NULL) {
-            lv_anim_del(s_state.fade_overlay, NULL);
             lv_obj_del(s_state.fade_overlay);
             s_state.fade_overlay = NULL;
         }
         ui_unlock();
     }
     
-    if (s_state.mutex != NULL) {
-        vSemaphoreDelete(s_state.mutex);
-        s_state.mutex = NULL;
-    }
-    
-    s_state.initialized = false;
     ESP_LOGI(TAG, "Deinitialized");
 }
 
@@ -294,29 +571,11 @@ void screen_timeout_notify_activity(void)
         return;
     }
     
-    if (xSemaphoreTake(s_state.mutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-        s_state.last_activity_us = esp_timer_get_time();
-        
-        switch (s_state.state) {
-            case SCREEN_STATE_OFF:
-                // Wake screen with fade-in - set flag for tick() to handle
-                ESP_LOGI(TAG, "Touch detected - waking screen");
-                s_state.pending_wake = true;
-                break;
-                
-            case SCREEN_STATE_FADING_OUT:
-                // Abort fade-out, will transition to fade-in
-                ESP_LOGI(TAG, "Touch during fade-out - will wake");
-                s_state.pending_wake = true;
-                break;
-                
-            case SCREEN_STATE_FADING_IN:
-            case SCREEN_STATE_ACTIVE:
-                // Already on or waking, just reset timer
-                break;
-        }
-        
-        xSemaphoreGive(s_state.mutex);
+    s_state.last_activity_ms = now_ms();
+    
+    screen_state_t state = s_state.state;
+    if (state == SCREEN_STATE_OFF || state == SCREEN_STATE_FADING_OUT) {
+        request_wake();
     }
 }
 
@@ -326,54 +585,33 @@ void screen_timeout_set_duration(uint16_t timeout_sec)
         return;
     }
     
-    if (xSemaphoreTake(s_state.mutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-        uint16_t old_timeout = s_state.timeout_sec;
-        s_state.timeout_sec = timeout_sec;
-        
-        // Clamp to valid range (0 or min-max)
-        if (s_state.timeout_sec != 0 && s_state.timeout_sec < SCREEN_TIMEOUT_MIN_SEC) {
-            s_state.timeout_sec = SCREEN_TIMEOUT_MIN_SEC;
-        } else if (s_state.timeout_sec > SCREEN_TIMEOUT_MAX_SEC) {
-            s_state.timeout_sec = SCREEN_TIMEOUT_MAX_SEC;
-        }
-        
-        if (old_timeout != s_state.timeout_sec) {
-            ESP_LOGI(TAG, "Timeout changed: %u -> %u sec", old_timeout, s_state.timeout_sec);
-        }
-        
-        // Reset timer when duration changes
-        s_state.last_activity_us = esp_timer_get_time();
-        
-        xSemaphoreGive(s_state.mutex);
+    // Clamp to valid range (0 or min-max)
+    if (timeout_sec != 0 && timeout_sec < SCREEN_TIMEOUT_MIN_SEC) {
+        timeout_sec = SCREEN_TIMEOUT_MIN_SEC;
+    } else if (timeout_sec > SCREEN_TIMEOUT_MAX_SEC) {
+        timeout_sec = SCREEN_TIMEOUT_MAX_SEC;
+    }
+    
+    if (s_state.timeout_sec != timeout_sec) {
+        ESP_LOGI(TAG, "Timeout changed: %u -> %u sec", s_state.timeout_sec, timeout_sec);
+    }
+    s_state.timeout_sec = timeout_sec;
+    
+    // Reset timer when duration changes
+    s_state.last_activity_ms = now_ms();
+    if (s_state.state == SCREEN_STATE_ACTIVE) {
+        deadline_arm_from_activity();
     }
 }
 
 uint16_t screen_timeout_get_duration(void)
 {
-    uint16_t timeout = 0;
-    
-    if (s_state.initialized && 
-        xSemaphoreTake(s_state.mutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-        timeout = s_state.timeout_sec;
-        xSemaphoreGive(s_state.mutex);
-    }
-    
-    return timeout;
+    return s_state.initialized ? s_state.timeout_sec : 0;
 }
 
 bool screen_timeout_is_screen_on(void)
 {
-    bool on = true;
-    
-    if (s_state.initialized && 
-        xSemaphoreTake(s_state.mutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-        on = (s_state.state == SCREEN_STATE_ACTIVE || 
-              s_state.state == SCREEN_STATE_FADING_IN ||
-              s_state.state == SCREEN_STATE_FADING_OUT);
-        xSemaphoreGive(s_state.mutex);
-    }
-    
-    return on;
+    return !s_state.initialized || s_state.state != SCREEN_STATE_OFF;
 }
 
 void screen_timeout_wake(void)
@@ -382,17 +620,9 @@ void screen_timeout_wake(void)
         return;
     }
     
-    if (xSemaphoreTake(s_state.mutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-        s_state.last_activity_us = esp_timer_get_time();
-        
-        if (s_state.state == SCREEN_STATE_OFF || 
-            s_state.state == SCREEN_STATE_FADING_OUT) {
-            ESP_LOGI(TAG, "Manual wake");
-            s_state.pending_wake = true;
-        }
-        
-        xSemaphoreGive(s_state.mutex);
-    }
+    s_state.last_activity_ms = now_ms();
+    ESP_LOGI(TAG, "Manual wake");
+    request_wake();
 }
 
 void screen_timeout_sleep(void)
@@ -401,67 +631,9 @@ void screen_timeout_sleep(void)
         return;
     }
     
-    if (xSemaphoreTake(s_state.mutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-        if (s_state.state == SCREEN_STATE_ACTIVE) {
-            ESP_LOGI(TAG, "Manual sleep - starting fade-out");
-            // Force timeout on next tick by setting last activity to 0
-            s_state.last_activity_us = 0;
-        }
-        
-        xSemaphoreGive(s_state.mutex);
-    }
-}
-
-void screen_timeout_tick(void)
-{
-    if (!s_state.initialized) {
-        return;
-    }
-    
-    if (xSemaphoreTake(s_state.mutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-        // Handle pending wake when screen is off (needs LVGL context)
-        if (s_state.pending_wake && s_state.state == SCREEN_STATE_OFF) {
-            s_state.pending_wake = false;
-            xSemaphoreGive(s_state.mutex);
-            
-            // Start fade-in in LVGL context
-            if (ui_lock()) {
-                start_fade_in();
-                ui_unlock();
-            }
-            return;
-        }
-        
-        // Skip if timeout is disabled
-        if (s_state.timeout_sec == 0) {
-            xSemaphoreGive(s_state.mutex);
-            return;
-        }
-        
-        // Only check timeout when in ACTIVE state
-        if (s_state.state != SCREEN_STATE_ACTIVE) {
-            xSemaphoreGive(s_state.mutex);
-            return;
-        }
-        
-        // Check if timeout has elapsed
-        int64_t now_us = esp_timer_get_time();
-        int64_t elapsed_us = now_us - s_state.last_activity_us;
-        int64_t timeout_us = (int64_t)s_state.timeout_sec * 1000000LL;
-        
-        if (elapsed_us >= timeout_us) {
-            ESP_LOGI(TAG, "Timeout elapsed (%u sec) - starting fade-out", 
-                     s_state.timeout_sec);
-            xSemaphoreGive(s_state.mutex);
-            
-            // Start fade-out in LVGL context
-            if (ui_lock()) {
-                start_fade_out();
-                ui_unlock();
-            }
-            return;
-        }
-        
-        xSemaphoreGive(s_state.mutex);
+    if (!ui_async_call(sleep_async_cb, NULL)) {
+        // Queue full: the deadline timer queues it instead
+        atomic_store(&s_state.sleep_retry, true);
+        deadline_arm(ASYNC_RETRY_MS);
     }
 }
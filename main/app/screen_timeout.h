@@ -9,7 +9,8 @@
  * - Configurable timeout duration via LCC CDI
  * - Touch-to-wake restores backlight immediately
  * - Timeout can be disabled (set to 0)
- * - Thread-safe activity notification
+ * - Lock-free activity notification (only stores a timestamp)
+ * - Deadline timer instead of polling; transitions run in LVGL context
  * 
  * @see docs/SPEC.md for power saving requirements
  * @see lcc_config.hxx for CDI configuration
@@ -69,8 +70,8 @@ void screen_timeout_deinit(void);
  * @brief Notify activity to reset timeout timer
  * 
  * Call this function whenever user activity is detected (touch events).
- * If the screen is off, this will turn it back on.
- * Thread-safe: can be called from any task.
+ * If the screen is off, this will turn it back on within one LVGL frame.
+ * Lock-free: can be called from any task, for every touch sample.
  */
 void screen_timeout_notify_activity(void);
 
@@ -107,14 +108,6 @@ void screen_timeout_wake(void);
  */
 void screen_timeout_sleep(void);
 
-/**
- * @brief Process timeout (called periodically from main loop or timer)
- * 
- * Call this function periodically (every 100-1000ms) to check for timeout.
- * Alternatively, the module can create its own timer task.
- */
-void screen_timeout_tick(void);
-
 #ifdef __cplusplus
 }
 #endif
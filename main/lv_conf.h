@@ -16,10 +16,12 @@
 #define LV_FONT_SUBPX 0
 #define LV_FONT_FMT_TXT_LARGE 0
 
-/* Memory settings */
-#define LV_MEM_CUSTOM 0
-#define LV_MEM_SIZE (64 * 1024U)
-#define LV_MEM_ADR 0
+/* Memory settings: tiered allocator in main/ui/ui_mem.c (matches CONFIG_LV_MEM_CUSTOM=y) */
+#define LV_MEM_CUSTOM 1
+#define LV_MEM_CUSTOM_INCLUDE "ui_mem.h"
+#define LV_MEM_CUSTOM_ALLOC ui_mem_alloc
+#define LV_MEM_CUSTOM_FREE ui_mem_free
+#define LV_MEM_CUSTOM_REALLOC ui_mem_realloc
 
 /* Display settings */
 #define LV_DISP_DEF_REFR_PERIOD 16  /* ~60 FPS for smooth scrolling */
@@ -47,7 +49,7 @@
 #endif
 
 /* Font settings */
-#define LV_FONT_MONTSERRAT_12 1
+#define LV_FONT_MONTSERRAT_12 0
 #define LV_FONT_MONTSERRAT_14 1
 #define LV_FONT_MONTSERRAT_16 1
 #define LV_FONT_MONTSERRAT_18 1
@@ -83,6 +85,9 @@
 #define LV_USE_FLEX 1
 #define LV_USE_GRID 1
 
+/* Others */
+#define LV_USE_SNAPSHOT 1
+
 /* Other settings */
 #define LV_USE_ASSERT_NULL 1
 #define LV_USE_ASSERT_MALLOC 1
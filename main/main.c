@@ -19,17 +19,20 @@
 #include "nvs_flash.h"
 #include "driver/i2c.h"
 #include "esp_heap_caps.h"
+#include "esp_timer.h"
 #include "jpeg_decoder.h"
 #include <sys/stat.h>
 
 // Board drivers
 #include "ch422g.h"
+#include "i2c_bus.h"
 #include "waveshare_lcd.h"
 #include "waveshare_touch.h"
 #include "waveshare_sd.h"
 
 // UI
 #include "ui_common.h"
+#include "ui_mem.h"
 
 // App modules
 #include "app/scene_storage.h"
@@ -76,6 +79,22 @@ static esp_err_t init_i2c(void)
     return ESP_OK;
 }
 
+/**
+ * @brief Hand the I2C bus to the bus manager task
+ *
+ * From here on CH422G writes and GT911 reads are queued, with touch first.
+ */
+static esp_err_t start_i2c_bus(void)
+{
+    i2c_bus_config_t bus_config = {
+        .i2c_port = I2C_NUM_0,
+        .timeout_ms = CONFIG_I2C_TRANSACTION_TIMEOUT_MS,
+        .task_priority = CONFIG_I2C_BUS_TASK_PRIORITY,
+        .core_id = 0,
+    };
+    return i2c_bus_start(&bus_config);
+}
+
 /**
  * @brief Initialize all board hardware
  * 
@@ -97,13 +116,18 @@ static esp_err_t init_hardware(void)
         ESP_LOGE(TAG, "Failed to initialize I2C: %s", esp_err_to_name(ret));
         return ret;
     }
+    ret = start_i2c_bus();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start I2C bus manager: %s", esp_err_to_name(ret));
+        return ret;
+    }
     ESP_LOGI(TAG, "I2C initialized successfully");
 
     ESP_LOGI(TAG, "Step 2: Initializing CH422G...");
     // 2. Initialize CH422G I/O Expander
     ch422g_config_t ch422g_config = {
         .i2c_port = I2C_NUM_0,
-        .timeout_ms = 1000,
+        .timeout_ms = CONFIG_I2C_TRANSACTION_TIMEOUT_MS,
     };
     ret = ch422g_init(&ch422g_config, &s_ch422g);
     if (ret != ESP_OK) {
@@ -157,6 +181,10 @@ static esp_err_t init_hardware(void)
         .h_res = CONFIG_LCD_H_RES,
         .v_res = CONFIG_LCD_V_RES,
         .ch422g_handle = s_ch422g,
+        .timeout_ms = CONFIG_I2C_TRANSACTION_TIMEOUT_MS,
+#if CONFIG_TOUCH_USE_INTERRUPT
+        .use_interrupt = true,
+#endif
     };
     ret = waveshare_touch_init(&touch_config, &s_touch);
     if (ret != ESP_OK) {
@@ -421,6 +449,33 @@ static void lighting_task(void *arg)
     }
 }
 
+#if CONFIG_LVGL_CPU_LOAD_STATS
+/**
+ * @brief CPU load of each core since the previous call, from idle task run time
+ *
+ * @param[out] load_pct Load per core in percent
+ */
+static void sample_cpu_load(uint32_t load_pct[portNUM_PROCESSORS])
+{
+    static uint32_t s_last_idle[portNUM_PROCESSORS];
+    static uint32_t s_last_total;
+    
+    uint32_t total = (uint32_t)portGET_RUN_TIME_COUNTER_VALUE();
+    uint32_t elapsed = total - s_last_total;
+    s_last_total = total;
+    
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        TaskStatus_t idle;
+        vTaskGetInfo(xTaskGetIdleTaskHandleForCPU(core), &idle, pdFALSE, eRunning);
+        uint32_t idle_time = idle.ulRunTimeCounter - s_last_idle[core];
+        s_last_idle[core] = idle.ulRunTimeCounter;
+        
+        load_pct[core] = (elapsed == 0 || idle_time >= elapsed) ?
+                         0 : 100 - (uint32_t)((uint64_t)idle_time * 100 / elapsed);
+    }
+}
+#endif
+
 /**
  * @brief Show SD card missing error screen
  * 
@@ -525,7 +580,7 @@ void app_main(void)
         if (ret == ESP_OK) {
             ch422g_config_t ch422g_config = {
                 .i2c_port = I2C_NUM_0,
-                .timeout_ms = 1000,
+                .timeout_ms = CONFIG_I2C_TRANSACTION_TIMEOUT_MS,
             };
             ret = ch422g_init(&ch422g_config, &s_ch422g);
         }
@@ -595,6 +650,9 @@ void app_main(void)
 
     // Ensure scenes.json exists (create default if not)
     ensure_scenes_json_exists();
+
+    // Parse scenes once into the scene cache; the UI is populated from it later
+    scene_storage_init();
     
     // Display splash image from SD card (FAT uses 8.3 filenames)
     ret = load_and_display_image(s_lcd_panel, "/sdcard/SPLASH.JPG");
@@ -680,10 +738,19 @@ void app_main(void)
     ui_show_main();
     ESP_LOGI(TAG, "Main UI displayed");
 
-    // Load scenes from SD card and populate Scene Selector tab
-    ESP_LOGI(TAG, "Loading scenes from SD card...");
+    // Populate Scene Selector tab from the scene cache
     scene_storage_reload_ui();
-    ESP_LOGI(TAG, "Scenes loaded");
+#if CONFIG_SCENE_BINARY_INDEX
+    ESP_LOGI(TAG, "Boot to first scene card: %lld ms (binary index enabled)",
+             (long long)(esp_timer_get_time() / 1000));
+#else
+    ESP_LOGI(TAG, "Boot to first scene card: %lld ms (binary index disabled)",
+             (long long)(esp_timer_get_time() / 1000));
+#endif
+
+#if CONFIG_LVGL_RENDER_BENCHMARK
+    ui_render_benchmark(CONFIG_LVGL_RENDER_BENCHMARK_FRAMES);
+#endif
 
     // Auto-apply first scene on boot if enabled
     if (lcc_node_get_auto_apply_enabled()) {
@@ -735,20 +802,35 @@ void app_main(void)
 
     ESP_LOGI(TAG, "Initialization complete - entering main loop");
 
-    // Main loop: Run screen timeout tick and report status periodically
-    TickType_t last_status_tick = xTaskGetTickCount();
+    // Main loop: report status periodically. The screen timeout runs on its
+    // own deadline timer and LCC pushes configuration changes, so nothing
+    // else needs polling.
     while (1) {
-        // Tick screen timeout every 500ms
-        screen_timeout_tick();
-        vTaskDelay(pdMS_TO_TICKS(500));
+        vTaskDelay(pdMS_TO_TICKS(10000));
         
-        // Report status every 10 seconds
-        if ((xTaskGetTickCount() - last_status_tick) >= pdMS_TO_TICKS(10000)) {
-            last_status_tick = xTaskGetTickCount();
-            ESP_LOGI(TAG, "Status - Free heap: %lu bytes, LCC: %s, Screen: %s", 
-                     esp_get_free_heap_size(),
-                     lcc_node_get_status() == LCC_STATUS_RUNNING ? "running" : "not running",
-                     screen_timeout_is_screen_on() ? "on" : "off");
+        ESP_LOGI(TAG, "Status - Free heap: %lu bytes, LCC: %s, Screen: %s", 
+                 esp_get_free_heap_size(),
+                 lcc_node_get_status() == LCC_STATUS_RUNNING ? "running" : "not running",
+                 screen_timeout_is_screen_on() ? "on" : "off");
+        char lvgl_mem[96];
+        ui_mem_format_stats(lvgl_mem, sizeof(lvgl_mem));
+        ESP_LOGI(TAG, "LVGL memory - %s", lvgl_mem);
+        for (int dev = 0; dev < I2C_BUS_DEV_COUNT; dev++) {
+            i2c_bus_stats_t bus_stats;
+            i2c_bus_get_stats(dev, &bus_stats);
+            if (bus_stats.errors > 0) {
+                ESP_LOGW(TAG, "I2C %s - %lu transactions, %lu errors (%lu timeouts, last %s), "
+                         "%lu coalesced, max latency %lu us",
+                         i2c_bus_dev_name(dev), bus_stats.transactions, bus_stats.errors,
+                         bus_stats.timeouts, esp_err_to_name(bus_stats.last_error),
+                         bus_stats.coalesced, bus_stats.max_latency_us);
+            }
         }
+#if CONFIG_LVGL_CPU_LOAD_STATS
+        uint32_t load_pct[portNUM_PROCESSORS];
+        sample_cpu_load(load_pct);
+        ESP_LOGI(TAG, "CPU load - core 0: %lu%%, core 1: %lu%%",
+                 load_pct[0], load_pct[portNUM_PROCESSORS - 1]);
+#endif
     }
 }
@@ -0,0 +1,433 @@
+/**
+ * @file ui_bench.c
+ * @brief Scripted interaction benchmark (CONFIG_LVGL_RENDER_BENCHMARK)
+ */
+
+#include "ui_bench.h"
+#include "ui_common.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if CONFIG_LVGL_RENDER_BENCHMARK
+
+static const char *TAG = "ui_bench";
+
+#define BENCH_FRAME_MS          16      ///< Frame pacing (touch sample and render period)
+#define BENCH_MAX_SAMPLES       256     ///< Frame times kept per phase for p99
+#define BENCH_DRAG_FRAMES       12      ///< Frames per carousel flick
+#define BENCH_SLIDER_FRAMES     30      ///< Frames per slider sweep
+#define BENCH_SETTLE_FRAMES     45      ///< Frames for scroll snap and animations to finish
+#define BENCH_CARD_EDIT_OFFSET  30      ///< Inside the card's edit button (see card_click_cb)
+
+/**
+ * @brief Statistics of one script phase
+ */
+typedef struct {
+    const char *name;
+    uint32_t frame_us[BENCH_MAX_SAMPLES];
+    uint32_t frames;
+    uint64_t sum_us;
+    uint32_t max_us;
+    uint64_t dirty_sum;
+    uint32_t dirty_max;
+    size_t heap_start;
+    size_t heap_min;
+} bench_phase_t;
+
+static lv_disp_t *s_disp = NULL;
+static lv_indev_t *s_indev = NULL;
+static bench_phase_t s_phase;
+
+// Scripted touch state, read by the input device
+static bool s_active = false;
+static bool s_pressed = false;
+static lv_point_t s_point;
+
+bool ui_bench_read_touch(lv_indev_data_t *data)
+{
+    if (!s_active) {
+        return false;
+    }
+
+    data->point = s_point;
+    data->state = s_pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+    return true;
+}
+
+static size_t heap_free(void)
+{
+    return heap_caps_get_free_size(MALLOC_CAP_8BIT);
+}
+
+/**
+ * @brief Pixels in the display's invalidated areas (as counted by ui_perf)
+ */
+static uint32_t dirty_pixels(void)
+{
+    uint32_t px = 0;
+    for (uint16_t i = 0; i < s_disp->inv_p; i++) {
+        px += lv_area_get_size(&s_disp->inv_areas[i]);
+    }
+    return px;
+}
+
+/**
+ * @brief Feed the current touch state to LVGL and render one frame
+ */
+static void frame(void)
+{
+    int64_t frame_start_us = esp_timer_get_time();
+
+    lv_indev_read_timer_cb(s_indev->driver->read_timer);
+    lv_anim_refr_now();
+
+    // Frames with nothing to draw are paced but not counted
+    uint32_t px = dirty_pixels();
+    if (px > 0) {
+        int64_t start_us = esp_timer_get_time();
+        lv_refr_now(s_disp);
+        uint32_t us = (uint32_t)(esp_timer_get_time() - start_us);
+
+        if (s_phase.frames < BENCH_MAX_SAMPLES) {
+            s_phase.frame_us[s_phase.frames] = us;
+        }
+        s_phase.frames++;
+        s_phase.sum_us += us;
+        if (us > s_phase.max_us) {
+            s_phase.max_us = us;
+        }
+        s_phase.dirty_sum += px;
+        if (px > s_phase.dirty_max) {
+            s_phase.dirty_max = px;
+        }
+    }
+
+    size_t free_now = heap_free();
+    if (free_now < s_phase.heap_min) {
+        s_phase.heap_min = free_now;
+    }
+
+    int64_t elapsed_ms = (esp_timer_get_time() - frame_start_us) / 1000;
+    if (elapsed_ms < BENCH_FRAME_MS) {
+        vTaskDelay(pdMS_TO_TICKS(BENCH_FRAME_MS - elapsed_ms));
+    }
+}
+
+static void settle(uint32_t frames)
+{
+    s_pressed = false;
+    for (uint32_t i = 0; i < frames; i++) {
+        frame();
+    }
+}
+
+/**
+ * @brief Press at one point, move linearly to another, release
+ */
+static void drag(lv_coord_t x0, lv_coord_t y0, lv_coord_t x1, lv_coord_t y1, uint32_t frames)
+{
+    s_pressed = true;
+    for (uint32_t i = 0; i <= frames; i++) {
+        s_point.x = x0 + (lv_coord_t)((int32_t)(x1 - x0) * (int32_t)i / (int32_t)frames);
+        s_point.y = y0 + (lv_coord_t)((int32_t)(y1 - y0) * (int32_t)i / (int32_t)frames);
+        frame();
+    }
+    s_pressed = false;
+    frame();
+}
+
+static void tap(lv_coord_t x, lv_coord_t y)
+{
+    drag(x, y, x, y, 2);
+}
+
+static void tap_obj(lv_obj_t *obj)
+{
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    tap((coords.x1 + coords.x2) / 2, (coords.y1 + coords.y2) / 2);
+}
+
+/**
+ * @brief Sweep a slider from its left end to its right end and back
+ */
+static void drag_slider(lv_obj_t *slider)
+{
+    lv_area_t coords;
+    lv_obj_get_coords(slider, &coords);
+    lv_coord_t y = (coords.y1 + coords.y2) / 2;
+    drag(coords.x1 + 5, y, coords.x2 - 5, y, BENCH_SLIDER_FRAMES);
+    drag(coords.x2 - 5, y, coords.x1 + 5, y, BENCH_SLIDER_FRAMES);
+}
+
+/**
+ * @brief Depth-first search for the first object of a class
+ */
+static lv_obj_t *find_class(lv_obj_t *root, const lv_obj_class_t *cls)
+{
+    uint32_t count = lv_obj_get_child_cnt(root);
+    for (uint32_t i = 0; i < count; i++) {
+        lv_obj_t *child = lv_obj_get_child(root, i);
+        if (lv_obj_check_type(child, cls)) {
+            return child;
+        }
+        lv_obj_t *found = find_class(child, cls);
+        if (found) {
+            return found;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Depth-first search for a button whose label contains a text
+ */
+static lv_obj_t *find_button(lv_obj_t *root, const char *text)
+{
+    uint32_t count = lv_obj_get_child_cnt(root);
+    for (uint32_t i = 0; i < count; i++) {
+        lv_obj_t *child = lv_obj_get_child(root, i);
+        if (lv_obj_check_type(child, &lv_label_class) &&
+            strstr(lv_label_get_text(child), text) != NULL &&
+            lv_obj_check_type(root, &lv_btn_class)) {
+            return root;
+        }
+        lv_obj_t *found = find_button(child, text);
+        if (found) {
+            return found;
+        }
+    }
+    return NULL;
+}
+
+static void phase_begin(const char *name)
+{
+    memset(&s_phase, 0, sizeof(s_phase));
+    s_phase.name = name;
+    s_phase.heap_start = heap_free();
+    s_phase.heap_min = s_phase.heap_start;
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void phase_end(void)
+{
+    if (s_phase.frames == 0) {
+        ESP_LOGW(TAG, "Script [%s]: nothing was redrawn", s_phase.name);
+        return;
+    }
+
+    size_t n = s_phase.frames < BENCH_MAX_SAMPLES ? s_phase.frames : BENCH_MAX_SAMPLES;
+    qsort(s_phase.frame_us, n, sizeof(uint32_t), compare_u32);
+
+    long heap_net = (long)s_phase.heap_start - (long)heap_free();
+    ESP_LOGI(TAG, "Script [%s]: %u frames | frame %.2f/%.2f/%.2f ms avg/p99/max | "
+             "dirty %u/%u px avg/max | heap peak +%u B, net %+ld B",
+             s_phase.name, (unsigned)s_phase.frames,
+             s_phase.sum_us / 1000.0f / s_phase.frames,
+             s_phase.frame_us[(n * 99) / 100] / 1000.0f,
+             s_phase.max_us / 1000.0f,
+             (unsigned)(s_phase.dirty_sum / s_phase.frames), (unsigned)s_phase.dirty_max,
+             (unsigned)(s_phase.heap_start - s_phase.heap_min), heap_net);
+}
+
+static void script_scenes(lv_obj_t *tabview)
+{
+    lv_tabview_set_act(tabview, 0, LV_ANIM_OFF);
+    settle(2);
+
+    // The carousel is the first child of the scenes tab
+    lv_obj_t *carousel = lv_obj_get_child(ui_get_scenes_tab(), 0);
+    lv_area_t coords;
+    lv_obj_get_coords(carousel, &coords);
+    lv_coord_t cx = (coords.x1 + coords.x2) / 2;
+    lv_coord_t cy = (coords.y1 + coords.y2) / 2;
+
+    phase_begin("carousel flick");
+    for (int i = 0; i < 2; i++) {
+        drag(cx + 200, cy, cx - 200, cy, BENCH_DRAG_FRAMES);
+        settle(BENCH_SETTLE_FRAMES);
+        drag(cx - 200, cy, cx + 200, cy, BENCH_DRAG_FRAMES);
+        settle(BENCH_SETTLE_FRAMES);
+    }
+    phase_end();
+
+    lv_point_t center = { cx, cy };
+    lv_obj_t *card = lv_indev_search_obj(carousel, &center);
+    if (card == NULL || card == carousel) {
+        ESP_LOGW(TAG, "Script: no scene card, skipping edit modal");
+        return;
+    }
+
+    uint32_t screen_children = lv_obj_get_child_cnt(lv_scr_act());
+    lv_obj_get_coords(card, &coords);
+
+    phase_begin("edit modal open");
+    tap(coords.x1 + BENCH_CARD_EDIT_OFFSET, coords.y1 + BENCH_CARD_EDIT_OFFSET);
+    settle(5);
+    phase_end();
+
+    if (lv_obj_get_child_cnt(lv_scr_act()) == screen_children) {
+        ESP_LOGW(TAG, "Script: edit modal did not open");
+        return;
+    }
+    lv_obj_t *modal = lv_obj_get_child(lv_scr_act(), -1);
+
+    lv_obj_t *slider = find_class(modal, &lv_slider_class);
+    if (slider) {
+        phase_begin("edit slider drag");
+        drag_slider(slider);
+        phase_end();
+    }
+
+    lv_obj_t *cancel = find_button(modal, "Cancel");
+    if (cancel) {
+        phase_begin("edit modal close");
+        tap_obj(cancel);
+        settle(5);
+        phase_end();
+    } else {
+        ESP_LOGW(TAG, "Script: edit modal has no Cancel button, deleting it");
+        lv_obj_del(modal);
+    }
+}
+
+static void script_manual(lv_obj_t *tabview)
+{
+    uint8_t brightness, red, green, blue, white;
+    ui_manual_get_values(&brightness, &red, &green, &blue, &white);
+
+    lv_tabview_set_act(tabview, 1, LV_ANIM_OFF);
+    lv_event_send(tabview, LV_EVENT_VALUE_CHANGED, NULL);  // Builds lazy tab content
+    settle(2);
+
+    lv_obj_t *slider = find_class(ui_get_manual_tab(), &lv_slider_class);
+    if (slider) {
+        phase_begin("manual slider drag");
+        drag_slider(slider);
+        phase_end();
+    }
+
+    // Colour wheel: only the cursor and the preview should be redrawn
+    lv_obj_t *mode_btn = find_button(ui_get_manual_tab(), "Wheel");
+    if (mode_btn) {
+        tap_obj(mode_btn);
+        settle(5);
+        lv_obj_t *wheel = find_class(ui_get_manual_tab(), &lv_canvas_class);
+        if (wheel) {
+            lv_area_t coords;
+            lv_obj_get_coords(wheel, &coords);
+            lv_coord_t cy = (coords.y1 + coords.y2) / 2;
+            phase_begin("manual wheel drag");
+            drag(coords.x1 + 10, cy, coords.x2 - 10, cy, BENCH_SLIDER_FRAMES);
+            drag(coords.x2 - 10, coords.y1 + 10, coords.x1 + 10, coords.y2 - 10, BENCH_SLIDER_FRAMES);
+            phase_end();
+        }
+        tap_obj(mode_btn);
+        settle(5);
+    }
+
+    ui_manual_set_values(brightness, red, green, blue, white);
+}
+
+/**
+ * @brief Preview colour as computed before the lookup tables (reference)
+ */
+static lv_color_t preview_color_reference(uint8_t brightness, uint8_t r, uint8_t g, uint8_t b, uint8_t w)
+{
+    uint16_t full_r = r + ((255 - r) * w) / 320;
+    uint16_t full_g = g + ((255 - g) * w) / 320;
+    uint16_t full_b = b + ((255 - b) * w) / 320;
+
+    uint32_t b_normalized = (brightness * 255);
+    uint32_t intensity = 0;
+    if (b_normalized > 0) {
+        uint32_t x = b_normalized;
+        uint32_t y = x;
+        while (y > (x / y)) {
+            y = (y + x / y) / 2;
+        }
+        intensity = y;
+    }
+    return lv_color_make((uint8_t)((full_r * intensity) / 255),
+                         (uint8_t)((full_g * intensity) / 255),
+                         (uint8_t)((full_b * intensity) / 255));
+}
+
+/**
+ * @brief Time ui_calculate_preview_color against the reference and check they agree
+ * 
+ * Sweeps every brightness and white value with the RGB channels derived from
+ * them, so all table entries are hit.
+ */
+static void bench_preview_color(void)
+{
+    volatile uint32_t sink = 0;
+    uint32_t mismatches = 0;
+    const uint32_t calls = 256 * 256;
+
+    int64_t start_us = esp_timer_get_time();
+    for (uint32_t i = 0; i < calls; i++) {
+        sink += lv_color_to32(preview_color_reference(i >> 8, i, i * 7, i * 13, i & 0xFF));
+    }
+    int64_t ref_us = esp_timer_get_time() - start_us;
+
+    start_us = esp_timer_get_time();
+    for (uint32_t i = 0; i < calls; i++) {
+        sink += lv_color_to32(ui_calculate_preview_color(i >> 8, i, i * 7, i * 13, i & 0xFF));
+    }
+    int64_t lut_us = esp_timer_get_time() - start_us;
+
+    for (uint32_t i = 0; i < calls; i++) {
+        lv_color_t a = preview_color_reference(i >> 8, i, i * 7, i * 13, i & 0xFF);
+        lv_color_t b = ui_calculate_preview_color(i >> 8, i, i * 7, i * 13, i & 0xFF);
+        if (a.full != b.full) {
+            mismatches++;
+        }
+    }
+    (void)sink;
+
+    ESP_LOGI(TAG, "Preview colour: reference %.1f ns/call, lookup %.1f ns/call, %u mismatches",
+             ref_us * 1000.0f / calls, lut_us * 1000.0f / calls, (unsigned)mismatches);
+}
+
+void ui_bench_run_script(lv_disp_t *disp, lv_indev_t *indev, lv_obj_t *tabview)
+{
+    if (!disp || !indev || !tabview) {
+        return;
+    }
+
+    s_disp = disp;
+    s_indev = indev;
+    s_pressed = false;
+    s_active = true;
+
+    script_scenes(tabview);
+    script_manual(tabview);
+    bench_preview_color();
+
+    s_active = false;
+}
+
+#else
+
+bool ui_bench_read_touch(lv_indev_data_t *data)
+{
+    return false;
+}
+
+void ui_bench_run_script(lv_disp_t *disp, lv_indev_t *indev, lv_obj_t *tabview)
+{
+}
+
+#endif
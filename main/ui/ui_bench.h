@@ -0,0 +1,50 @@
+/**
+ * @file ui_bench.h
+ * @brief Scripted interaction benchmark (CONFIG_LVGL_RENDER_BENCHMARK)
+ *
+ * Replays a fixed sequence of touch gestures through the real touch input
+ * device and the real UI code:
+ * - Flick the scene carousel left and right
+ * - Open the edit modal of the centred card, drag a slider, cancel
+ * - Drag the manual control sliders
+ *
+ * Each phase reports frame time (avg/p99/max), dirty-area pixels per frame
+ * (avg/max), and the heap high-water mark and net change over the phase.
+ * Frames are rendered with lv_refr_now() at a fixed pace, so results are
+ * comparable between builds.
+ */
+
+#pragma once
+
+#include "lvgl.h"
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Report the scripted touch point while a script is running
+ *
+ * Called first from the touch input read callback.
+ *
+ * @param data Input data to fill
+ * @return true if the script owns the touch input (data was filled)
+ */
+bool ui_bench_read_touch(lv_indev_data_t *data);
+
+/**
+ * @brief Run the interaction script and log one line per phase
+ *
+ * Call with the LVGL mutex held. Manual control values are restored
+ * afterwards; the scene carousel ends on the card it started on.
+ *
+ * @param disp Display to render
+ * @param indev Touch input device
+ * @param tabview Main tabview (scenes tab 0, manual tab 1)
+ */
+void ui_bench_run_script(lv_disp_t *disp, lv_indev_t *indev, lv_obj_t *tabview);
+
+#ifdef __cplusplus
+}
+#endif
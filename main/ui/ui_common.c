@@ -4,14 +4,19 @@
  */
 
 #include "ui_common.h"
+#include "ui_perf.h"
+#include "ui_bench.h"
 #include "esp_log.h"
 #include "esp_check.h"
 #include "esp_timer.h"
+#include "esp_heap_caps.h"
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_touch.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
+#include "freertos/queue.h"
+#include <stdatomic.h>
 
 // Board drivers
 #include "waveshare_lcd.h"
@@ -26,6 +31,52 @@ static const char *TAG = "ui_common";
 static lv_disp_t *s_disp = NULL;
 static lv_indev_t *s_touch_indev = NULL;
 static SemaphoreHandle_t s_lvgl_mutex = NULL;
+static TaskHandle_t s_lvgl_task = NULL;
+static esp_timer_handle_t s_lvgl_tick_timer = NULL;
+
+#if CONFIG_LVGL_DEEP_IDLE
+// Screen off: no LVGL timers run, the tick is stopped, the panel is slowed
+static bool s_render_paused = false;        // LVGL context only
+static int64_t s_wake_touch_us = 0;         // Sample time of the touch that ended deep idle
+#endif
+
+// Calls queued by ui_async_call(), run by the LVGL task
+#define UI_ASYNC_QUEUE_LEN  8
+
+typedef struct {
+    lv_async_cb_t cb;
+    void *user_data;
+} ui_async_msg_t;
+
+static QueueHandle_t s_async_queue = NULL;
+
+// Set by the touch reader task, consumed by the LVGL task
+static atomic_bool s_touch_pending = false;
+static uint32_t s_touch_last_seq = 0;
+
+#if CONFIG_LVGL_DIRECT_MODE
+// Given by the panel's VSYNC interrupt; the flush callback waits on it after a swap
+static SemaphoreHandle_t s_vsync_sem = NULL;
+#endif
+
+#if !CONFIG_LVGL_DIRECT_MODE
+// Partial-mode draw buffers: strips rendered by LVGL, then copied to the framebuffer
+#define UI_DRAW_BUF_ALIGN           64      // Cache line / DMA burst size
+#define UI_DRAW_BUF_MIN_LINES       10      // Below this, internal buffers are not worth it
+
+typedef enum {
+    DRAW_BUF_INTERNAL,      ///< DMA-capable internal SRAM, sized from free heap
+    DRAW_BUF_PSRAM,         ///< PSRAM, CONFIG_LCD_RGB_BOUNCE_BUFFER_HEIGHT lines
+} draw_buf_strategy_t;
+
+static const char *const s_draw_buf_strategy_names[] = {
+    [DRAW_BUF_INTERNAL] = "internal",
+    [DRAW_BUF_PSRAM] = "psram",
+};
+
+static draw_buf_strategy_t s_draw_buf_strategy;
+#endif
+
 
 // Hardware handles (from main)
 extern esp_lcd_panel_handle_t s_lcd_panel;
@@ -37,11 +88,49 @@ static void lvgl_touch_cb(lv_indev_drv_t *drv, lv_indev_data_t *data);
 static void lvgl_tick_timer_cb(void *arg);
 static void lvgl_task(void *arg);
 
+
+#if CONFIG_LVGL_DIRECT_MODE
+/**
+ * @brief Panel VSYNC interrupt - signals that a buffer swap has taken effect
+ */
+static bool IRAM_ATTR lvgl_vsync_cb(esp_lcd_panel_handle_t panel,
+                                    const esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx)
+{
+    BaseType_t need_yield = pdFALSE;
+    xSemaphoreGiveFromISR(s_vsync_sem, &need_yield);
+    return need_yield == pdTRUE;
+}
+
+/**
+ * @brief LVGL flush callback (direct mode) - swaps framebuffers on VSYNC
+ *
+ * LVGL renders straight into the panel's back framebuffer, so there is nothing
+ * to copy. After the last area of a frame, point the panel at that buffer and
+ * wait for VSYNC so LVGL never draws into the buffer being scanned out. LVGL
+ * copies this frame's dirty areas into the other buffer before the next frame.
+ */
+static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    ui_perf_flush_begin();
+    if (lv_disp_flush_is_last(drv)) {
+        esp_lcd_panel_handle_t panel = (esp_lcd_panel_handle_t)drv->user_data;
+        
+        // Passing one of the panel's own framebuffers switches to it without copying
+        xSemaphoreTake(s_vsync_sem, 0);
+        esp_lcd_panel_draw_bitmap(panel, 0, 0, drv->hor_res, drv->ver_res, color_map);
+        xSemaphoreTake(s_vsync_sem, pdMS_TO_TICKS(100));
+    }
+    
+    ui_perf_flush_end();
+    lv_disp_flush_ready(drv);
+}
+#else
 /**
  * @brief LVGL flush callback - copies framebuffer to LCD
  */
 static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
 {
+    ui_perf_flush_begin();
     esp_lcd_panel_handle_t panel = (esp_lcd_panel_handle_t)drv->user_data;
     int offsetx1 = area->x1;
     int offsety1 = area->y1;
@@ -51,34 +140,113 @@ static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
     // Draw bitmap to LCD
     esp_lcd_panel_draw_bitmap(panel, offsetx1, offsety1, offsetx2 + 1, offsety2 + 1, color_map);
     
+    ui_perf_flush_end();
     lv_disp_flush_ready(drv);
 }
+#endif
+
+#if !CONFIG_LVGL_DIRECT_MODE
+/**
+ * @brief Allocate a pair of partial-mode draw buffers
+ *
+ * Internal buffers take as many lines as fit in half of the free internal DMA
+ * heap above CONFIG_LVGL_DRAW_BUF_INTERNAL_RESERVE_KB, capped at
+ * CONFIG_LVGL_DRAW_BUF_INTERNAL_MAX_LINES.
+ *
+ * @param[out] out_px Pixels per buffer
+ * @return true on success; on failure nothing is allocated
+ */
+static bool draw_buf_alloc(draw_buf_strategy_t strategy, lv_color_t **out_buf1,
+                           lv_color_t **out_buf2, size_t *out_px)
+{
+    size_t lines = CONFIG_LCD_RGB_BOUNCE_BUFFER_HEIGHT;
+    uint32_t caps = MALLOC_CAP_SPIRAM;
+    
+    if (strategy == DRAW_BUF_INTERNAL) {
+        caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA;
+        size_t free_bytes = heap_caps_get_free_size(caps);
+        size_t reserve = CONFIG_LVGL_DRAW_BUF_INTERNAL_RESERVE_KB * 1024;
+        size_t budget = free_bytes > reserve ? (free_bytes - reserve) / 2 : 0;
+        size_t largest = heap_caps_get_largest_free_block(caps);
+        if (budget > largest) {
+            budget = largest;
+        }
+        lines = budget / (CONFIG_LCD_H_RES * sizeof(lv_color_t));
+        if (lines > CONFIG_LVGL_DRAW_BUF_INTERNAL_MAX_LINES) {
+            lines = CONFIG_LVGL_DRAW_BUF_INTERNAL_MAX_LINES;
+        }
+        if (lines < UI_DRAW_BUF_MIN_LINES) {
+            ESP_LOGW(TAG, "Internal heap too small for draw buffers (%u bytes free)",
+                     (unsigned)free_bytes);
+            return false;
+        }
+    }
+    
+    size_t bytes = CONFIG_LCD_H_RES * lines * sizeof(lv_color_t);
+    lv_color_t *buf1 = heap_caps_aligned_alloc(UI_DRAW_BUF_ALIGN, bytes, caps);
+    lv_color_t *buf2 = heap_caps_aligned_alloc(UI_DRAW_BUF_ALIGN, bytes, caps);
+    if (!buf1 || !buf2) {
+        heap_caps_free(buf1);
+        heap_caps_free(buf2);
+        return false;
+    }
+    
+    *out_buf1 = buf1;
+    *out_buf2 = buf2;
+    *out_px = CONFIG_LCD_H_RES * lines;
+    ESP_LOGI(TAG, "LVGL draw buffers: 2 x %u lines in %s", (unsigned)lines,
+             s_draw_buf_strategy_names[strategy]);
+    return true;
+}
+#endif
+
+/**
+ * @brief Touch reader task callback - a new sample is waiting
+ */
+static void touch_sample_cb(void *ctx)
+{
+    atomic_store(&s_touch_pending, true);
+    ui_wake();
+}
 
 /**
  * @brief LVGL touch read callback
+ *
+ * Copies the reader task's latest sample; no I2C access happens here.
  */
 static void lvgl_touch_cb(lv_indev_drv_t *drv, lv_indev_data_t *data)
 {
-    esp_lcd_touch_handle_t touch = (esp_lcd_touch_handle_t)drv->user_data;
+#if CONFIG_LVGL_RENDER_BENCHMARK
+    if (ui_bench_read_touch(data)) {
+        return;
+    }
+#endif
 
-    // Read touch data
-    esp_lcd_touch_read_data(touch);
+    waveshare_touch_sample_t sample;
+    waveshare_touch_get_sample(&sample);
 
-    // Get touch data using new API
-    esp_lcd_touch_point_data_t point_data;
-    uint8_t point_cnt = 0;
-    
-    esp_err_t ret = esp_lcd_touch_get_data(touch, &point_data, &point_cnt, 1);
-
-    if (ret == ESP_OK && point_cnt > 0) {
-        data->point.x = point_data.x;
-        data->point.y = point_data.y;
+    if (sample.count > 0) {
+        data->point.x = sample.x;
+        data->point.y = sample.y;
         data->state = LV_INDEV_STATE_PRESSED;
         
+        if (sample.seq != s_touch_last_seq) {
+            s_touch_last_seq = sample.seq;
+            ui_perf_touch_input(sample.timestamp_us);
+        }
+        
         // Notify screen timeout module of touch activity
         screen_timeout_notify_activity();
     } else {
         data->state = LV_INDEV_STATE_RELEASED;
+#if CONFIG_LVGL_IDLE_SLEEP
+        // Stop reading once LVGL has processed the release and any scroll
+        // throw has finished; the reader task resumes us on the next touch
+        if (s_touch_indev->proc.state == LV_INDEV_STATE_RELEASED &&
+            s_touch_indev->proc.types.pointer.scroll_obj == NULL) {
+            lv_timer_pause(drv->read_timer);
+        }
+#endif
     }
 }
 
@@ -90,6 +258,52 @@ static void lvgl_tick_timer_cb(void *arg)
     lv_tick_inc(UI_LVGL_TICK_PERIOD_MS);
 }
 
+#if CONFIG_LVGL_DEEP_IDLE
+/**
+ * @brief Touch while the render is paused (LVGL task, mutex held)
+ */
+static void deep_idle_touch(void)
+{
+    waveshare_touch_sample_t sample;
+    waveshare_touch_get_sample(&sample);
+    if (sample.count > 0) {
+        if (s_wake_touch_us == 0) {
+            s_wake_touch_us = sample.timestamp_us;
+        }
+        screen_timeout_notify_activity();
+    }
+}
+
+/**
+ * @brief Enter or leave deep idle (LVGL context)
+ */
+static void deep_idle_set(bool enter)
+{
+    if (enter == s_render_paused) {
+        return;
+    }
+
+    if (enter) {
+        s_render_paused = true;
+        esp_timer_stop(s_lvgl_tick_timer);
+        waveshare_lcd_set_pixel_clock(s_lcd_panel, CONFIG_LVGL_DEEP_IDLE_PCLK_HZ);
+        ESP_LOGI(TAG, "Deep idle: render paused, pixel clock %d Hz",
+                 CONFIG_LVGL_DEEP_IDLE_PCLK_HZ);
+    } else {
+        waveshare_lcd_set_pixel_clock(s_lcd_panel, CONFIG_LCD_PIXEL_CLOCK_HZ);
+        esp_timer_start_periodic(s_lvgl_tick_timer, UI_LVGL_TICK_PERIOD_MS * 1000);
+        s_render_paused = false;
+        if (s_wake_touch_us != 0) {
+            ESP_LOGI(TAG, "Deep idle exit %lld us after touch",
+                     (long long)(esp_timer_get_time() - s_wake_touch_us));
+            s_wake_touch_us = 0;
+        } else {
+            ESP_LOGI(TAG, "Deep idle exit");
+        }
+    }
+}
+#endif
+
 /**
  * @brief LVGL task - handles rendering and input
  */
@@ -100,17 +314,47 @@ static void lvgl_task(void *arg)
     while (1) {
         // Lock mutex
         if (xSemaphoreTake(s_lvgl_mutex, pdMS_TO_TICKS(10)) == pdTRUE) {
+            bool touch = atomic_exchange(&s_touch_pending, false);
+#if CONFIG_LVGL_DEEP_IDLE
+            if (touch && s_render_paused) {
+                // Only wake the screen; the touch is not passed to the UI
+                deep_idle_touch();
+                touch = false;
+            }
+#endif
+            if (touch) {
+                lv_timer_resume(s_touch_indev->driver->read_timer);
+            }
+            ui_async_msg_t msg;
+            while (xQueueReceive(s_async_queue, &msg, 0) == pdTRUE) {
+                msg.cb(msg.user_data);
+            }
+#if CONFIG_LVGL_DEEP_IDLE
+            if (s_render_paused) {
+                // Sleep until a touch, ui_unlock() or ui_async_call()
+                xSemaphoreGive(s_lvgl_mutex);
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+                continue;
+            }
+#endif
+            ui_perf_handler_begin();
             uint32_t task_delay_ms = lv_timer_handler();
+            ui_perf_handler_end();
             xSemaphoreGive(s_lvgl_mutex);
             
-            // Clamp delay
+            // Clamp delay (LV_NO_TIMER_READY when every timer is paused)
             if (task_delay_ms > UI_LVGL_TASK_MAX_DELAY_MS) {
                 task_delay_ms = UI_LVGL_TASK_MAX_DELAY_MS;
             } else if (task_delay_ms < UI_LVGL_TASK_MIN_DELAY_MS) {
                 task_delay_ms = UI_LVGL_TASK_MIN_DELAY_MS;
             }
             
+#if CONFIG_LVGL_IDLE_SLEEP
+            // Sleep until the next timer is due or another task changes the UI
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(task_delay_ms));
+#else
             vTaskDelay(pdMS_TO_TICKS(task_delay_ms));
+#endif
         } else {
             vTaskDelay(pdMS_TO_TICKS(UI_LVGL_TASK_MIN_DELAY_MS));
         }
@@ -130,16 +374,48 @@ esp_err_t ui_init(lv_disp_t **disp, lv_indev_t **touch_indev)
     // Create mutex
     s_lvgl_mutex = xSemaphoreCreateMutex();
     ESP_RETURN_ON_FALSE(s_lvgl_mutex != NULL, ESP_ERR_NO_MEM, TAG, "Failed to create mutex");
+    s_async_queue = xQueueCreate(UI_ASYNC_QUEUE_LEN, sizeof(ui_async_msg_t));
+    ESP_RETURN_ON_FALSE(s_async_queue != NULL, ESP_ERR_NO_MEM, TAG, "Failed to create async queue");
 
     // Initialize LVGL
     lv_init();
 
-    // Allocate draw buffers (in SPIRAM for better performance)
-    size_t buffer_size = CONFIG_LCD_H_RES * CONFIG_LCD_RGB_BOUNCE_BUFFER_HEIGHT;
-    lv_color_t *buf1 = heap_caps_malloc(buffer_size * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
-    lv_color_t *buf2 = heap_caps_malloc(buffer_size * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+#if CONFIG_LVGL_DIRECT_MODE
+    // Draw directly into the panel's two PSRAM framebuffers
+    size_t buffer_size = CONFIG_LCD_H_RES * CONFIG_LCD_V_RES;
+    void *buf1 = NULL;
+    void *buf2 = NULL;
+    ESP_RETURN_ON_ERROR(
+        waveshare_lcd_get_frame_buffer(s_lcd_panel, 2, &buf1, &buf2),
+        TAG, "Failed to get panel framebuffers (direct mode needs num_fb = 2)"
+    );
     
-    ESP_RETURN_ON_FALSE(buf1 && buf2, ESP_ERR_NO_MEM, TAG, "Failed to allocate LVGL buffers");
+    s_vsync_sem = xSemaphoreCreateBinary();
+    ESP_RETURN_ON_FALSE(s_vsync_sem != NULL, ESP_ERR_NO_MEM, TAG, "Failed to create VSYNC semaphore");
+    ESP_RETURN_ON_ERROR(
+        waveshare_lcd_register_vsync_callback(s_lcd_panel, lvgl_vsync_cb, NULL),
+        TAG, "Failed to register VSYNC callback"
+    );
+    ESP_LOGI(TAG, "LVGL direct mode: rendering into panel framebuffers %p / %p", buf1, buf2);
+#else
+    // Allocate draw buffers; internal SRAM falls back to PSRAM if it does not fit
+#if CONFIG_LVGL_DRAW_BUF_INTERNAL
+    s_draw_buf_strategy = DRAW_BUF_INTERNAL;
+#else
+    s_draw_buf_strategy = DRAW_BUF_PSRAM;
+#endif
+    size_t buffer_size = 0;
+    lv_color_t *buf1 = NULL;
+    lv_color_t *buf2 = NULL;
+    bool allocated = draw_buf_alloc(s_draw_buf_strategy, &buf1, &buf2, &buffer_size);
+    if (!allocated && s_draw_buf_strategy != DRAW_BUF_PSRAM) {
+        ESP_LOGW(TAG, "Falling back to PSRAM draw buffers");
+        s_draw_buf_strategy = DRAW_BUF_PSRAM;
+        allocated = draw_buf_alloc(s_draw_buf_strategy, &buf1, &buf2, &buffer_size);
+    }
+    
+    ESP_RETURN_ON_FALSE(allocated, ESP_ERR_NO_MEM, TAG, "Failed to allocate LVGL buffers");
+#endif
 
     // Initialize display buffer
     static lv_disp_draw_buf_t disp_buf;
@@ -153,9 +429,13 @@ esp_err_t ui_init(lv_disp_t **disp, lv_indev_t **touch_indev)
     disp_drv.flush_cb = lvgl_flush_cb;
     disp_drv.draw_buf = &disp_buf;
     disp_drv.user_data = s_lcd_panel;
+#if CONFIG_LVGL_DIRECT_MODE
+    disp_drv.direct_mode = 1;
+#endif
     
     s_disp = lv_disp_drv_register(&disp_drv);
     ESP_RETURN_ON_FALSE(s_disp != NULL, ESP_FAIL, TAG, "Failed to register display driver");
+    ui_perf_init(s_disp);
 
     // Register touch input driver
     static lv_indev_drv_t indev_drv;
@@ -167,18 +447,30 @@ esp_err_t ui_init(lv_disp_t **disp, lv_indev_t **touch_indev)
     s_touch_indev = lv_indev_drv_register(&indev_drv);
     ESP_RETURN_ON_FALSE(s_touch_indev != NULL, ESP_FAIL, TAG, "Failed to register touch driver");
 
+    // GT911 reads happen in their own task; lvgl_touch_cb copies the result
+    waveshare_touch_reader_config_t reader_cfg = {
+        .priority = UI_LVGL_TASK_PRIORITY + 1,
+        .core_id = tskNO_AFFINITY,
+        .poll_ms = CONFIG_TOUCH_POLL_PERIOD_MS,
+        .on_sample = touch_sample_cb,
+        .ctx = NULL,
+    };
+    ESP_RETURN_ON_ERROR(
+        waveshare_touch_start_reader(s_touch, &reader_cfg),
+        TAG, "Failed to start touch reader"
+    );
+
     // Create tick timer
     const esp_timer_create_args_t lvgl_tick_timer_args = {
         .callback = lvgl_tick_timer_cb,
         .name = "lvgl_tick"
     };
-    esp_timer_handle_t lvgl_tick_timer = NULL;
     ESP_RETURN_ON_ERROR(
-        esp_timer_create(&lvgl_tick_timer_args, &lvgl_tick_timer),
+        esp_timer_create(&lvgl_tick_timer_args, &s_lvgl_tick_timer),
         TAG, "Failed to create LVGL tick timer"
     );
     ESP_RETURN_ON_ERROR(
-        esp_timer_start_periodic(lvgl_tick_timer, UI_LVGL_TICK_PERIOD_MS * 1000),
+        esp_timer_start_periodic(s_lvgl_tick_timer, UI_LVGL_TICK_PERIOD_MS * 1000),
         TAG, "Failed to start LVGL tick timer"
     );
 
@@ -189,7 +481,7 @@ esp_err_t ui_init(lv_disp_t **disp, lv_indev_t **touch_indev)
         UI_LVGL_TASK_STACK_SIZE_KB * 1024,
         NULL,
         UI_LVGL_TASK_PRIORITY,
-        NULL,
+        &s_lvgl_task,
         1  // Pin to CPU1
     );
     ESP_RETURN_ON_FALSE(ret == pdPASS, ESP_FAIL, TAG, "Failed to create LVGL task");
@@ -201,6 +493,84 @@ esp_err_t ui_init(lv_disp_t **disp, lv_indev_t **touch_indev)
     return ESP_OK;
 }
 
+#if CONFIG_LVGL_RENDER_BENCHMARK
+/**
+ * @brief Time full-screen redraws of one tab
+ *
+ * @return Average milliseconds per frame
+ */
+static float benchmark_tab(lv_obj_t *tabview, uint32_t tab, uint32_t frames)
+{
+    lv_tabview_set_act(tabview, tab, LV_ANIM_OFF);
+    lv_event_send(tabview, LV_EVENT_VALUE_CHANGED, NULL);  // Builds lazy tab content
+    lv_refr_now(s_disp);
+    
+    int64_t start_us = esp_timer_get_time();
+    for (uint32_t i = 0; i < frames; i++) {
+        lv_obj_invalidate(lv_scr_act());
+        lv_refr_now(s_disp);
+    }
+    return (esp_timer_get_time() - start_us) / 1000.0f / frames;
+}
+
+/**
+ * @brief Log ms/frame of both tabs for the current draw buffers
+ */
+static void benchmark_report(lv_obj_t *tabview, const char *strategy, uint32_t frames)
+{
+    float scenes_ms = benchmark_tab(tabview, 0, frames);
+    float manual_ms = benchmark_tab(tabview, 1, frames);
+    ESP_LOGI(TAG, "Benchmark [%s]: scenes tab %.2f ms/frame, manual tab %.2f ms/frame (%u frames)",
+             strategy, scenes_ms, manual_ms, (unsigned)frames);
+}
+
+void ui_render_benchmark(uint32_t frames)
+{
+    if (!s_disp || frames == 0) {
+        return;
+    }
+    
+    ui_lock();
+    // Tabs live in the tabview's content container
+    lv_obj_t *tabview = lv_obj_get_parent(lv_obj_get_parent(ui_get_scenes_tab()));
+    uint16_t prev_tab = lv_tabview_get_tab_act(tabview);
+    
+#if CONFIG_LVGL_DIRECT_MODE
+    benchmark_report(tabview, "direct", frames);
+#else
+    benchmark_report(tabview, s_draw_buf_strategy_names[s_draw_buf_strategy], frames);
+    
+    // Temporarily swap in the other partial-mode strategy for comparison
+    draw_buf_strategy_t other = s_draw_buf_strategy == DRAW_BUF_INTERNAL ?
+                                DRAW_BUF_PSRAM : DRAW_BUF_INTERNAL;
+    lv_color_t *buf1 = NULL;
+    lv_color_t *buf2 = NULL;
+    size_t px = 0;
+    if (draw_buf_alloc(other, &buf1, &buf2, &px)) {
+        lv_disp_draw_buf_t *configured = s_disp->driver->draw_buf;
+        lv_disp_draw_buf_t bench_buf;
+        lv_disp_draw_buf_init(&bench_buf, buf1, buf2, px);
+        s_disp->driver->draw_buf = &bench_buf;
+        
+        benchmark_report(tabview, s_draw_buf_strategy_names[other], frames);
+        
+        s_disp->driver->draw_buf = configured;
+        heap_caps_free(buf1);
+        heap_caps_free(buf2);
+    } else {
+        ESP_LOGW(TAG, "Benchmark: could not allocate %s draw buffers",
+                 s_draw_buf_strategy_names[other]);
+    }
+#endif
+    
+    ui_bench_run_script(s_disp, s_touch_indev, tabview);
+    
+    lv_tabview_set_act(tabview, prev_tab, LV_ANIM_OFF);
+    lv_obj_invalidate(lv_scr_act());
+    ui_unlock();
+}
+#endif
+
 bool ui_lock(void)
 {
     if (s_lvgl_mutex == NULL) {
@@ -213,5 +583,44 @@ void ui_unlock(void)
 {
     if (s_lvgl_mutex != NULL) {
         xSemaphoreGive(s_lvgl_mutex);
+        // The caller may have invalidated objects or started timers
+        ui_wake();
+    }
+}
+
+void ui_wake(void)
+{
+#if CONFIG_LVGL_IDLE_SLEEP
+    if (s_lvgl_task != NULL && xTaskGetCurrentTaskHandle() != s_lvgl_task) {
+        xTaskNotifyGive(s_lvgl_task);
     }
+#endif
+}
+
+bool ui_async_call(lv_async_cb_t cb, void *user_data)
+{
+    ui_async_msg_t msg = {
+        .cb = cb,
+        .user_data = user_data,
+    };
+    if (s_async_queue == NULL || xQueueSend(s_async_queue, &msg, 0) != pdTRUE) {
+        ESP_LOGW(TAG, "Async call dropped");
+        return false;
+    }
+    ui_wake();
+    return true;
+}
+
+void ui_set_screen_off_no_lock(bool screen_off)
+{
+#if CONFIG_LVGL_DEEP_IDLE
+    deep_idle_set(screen_off);
+#endif
+#if CONFIG_LVGL_IDLE_SLEEP
+    // Nothing is drawn while the backlight is off; only a touch matters
+    uint32_t poll_ms = screen_off ? CONFIG_LVGL_SCREEN_OFF_TOUCH_POLL_MS
+                                  : CONFIG_TOUCH_POLL_PERIOD_MS;
+    waveshare_touch_set_poll_period(poll_ms);
+    ESP_LOGD(TAG, "Touch poll period %lu ms", (unsigned long)poll_ms);
+#endif
 }
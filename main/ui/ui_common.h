@@ -66,9 +66,56 @@ bool ui_lock(void);
 
 /**
  * @brief Unlock LVGL mutex
+ * 
+ * Also wakes the LVGL task so changes made under the lock are drawn
+ * without waiting for its next timer.
  */
 void ui_unlock(void);
 
+/**
+ * @brief Wake the LVGL task (CONFIG_LVGL_IDLE_SLEEP)
+ * 
+ * The LVGL task sleeps until its next timer is due. Call after changing
+ * LVGL state from another task without ui_lock()/ui_unlock().
+ */
+void ui_wake(void);
+
+/**
+ * @brief Run a function in LVGL context (any task, never blocks)
+ * 
+ * Like lv_async_call(), but safe without the LVGL mutex: the call is
+ * queued and the LVGL task runs it, with the mutex held, before its next
+ * lv_timer_handler(). Calls run in the order they were queued.
+ * 
+ * @param cb Function to call
+ * @param user_data Passed to cb
+ * @return false if the queue is full or LVGL is not initialized
+ */
+bool ui_async_call(lv_async_cb_t cb, void *user_data);
+
+/**
+ * @brief Switch between normal operation and screen-off power saving
+ * 
+ * Call from LVGL context when the backlight turns off or back on. Screen
+ * off polls touch at CONFIG_LVGL_SCREEN_OFF_TOUCH_POLL_MS and, with
+ * CONFIG_LVGL_DEEP_IDLE, pauses LVGL and slows the panel pixel clock.
+ * A touch then only wakes the screen.
+ * 
+ * @param screen_off true when the backlight has turned off
+ */
+void ui_set_screen_off_no_lock(bool screen_off);
+
+/**
+ * @brief Time full redraws of the scenes and manual tabs (CONFIG_LVGL_RENDER_BENCHMARK)
+ * 
+ * Logs ms/frame for each tab with the configured draw buffers and, in
+ * partial mode, with the other draw buffer strategy. Then replays the
+ * scripted interactions of ui_bench.h. Takes the LVGL mutex.
+ * 
+ * @param frames Redraws per tab
+ */
+void ui_render_benchmark(uint32_t frames);
+
 // ----- Main Screen Functions -----
 
 /**
@@ -78,6 +125,9 @@ void ui_create_main_screen(void);
 
 /**
  * @brief Get the manual control tab object
+ * 
+ * Its content is built the first time the tab is selected (tabview
+ * LV_EVENT_VALUE_CHANGED) or swiped towards.
  */
 lv_obj_t* ui_get_manual_tab(void);
 
@@ -86,6 +136,30 @@ lv_obj_t* ui_get_manual_tab(void);
  */
 lv_obj_t* ui_get_scenes_tab(void);
 
+// ----- Shared Keyboard -----
+// One keyboard on lv_layer_top(), built in an idle slice after boot and
+// reused by every modal (LVGL context)
+
+/**
+ * @brief Attach the keyboard to a textarea and show it at the bottom of the screen
+ * 
+ * @param textarea Textarea receiving the input
+ * @param height Keyboard height in pixels
+ */
+void ui_keyboard_show_no_lock(lv_obj_t *textarea, lv_coord_t height);
+
+/**
+ * @brief Hide the keyboard (it stays attached to its textarea)
+ */
+void ui_keyboard_hide_no_lock(void);
+
+/**
+ * @brief Hide and detach the keyboard if it is attached to a textarea
+ * 
+ * Call before deleting the textarea (or the modal containing it).
+ */
+void ui_keyboard_release_no_lock(lv_obj_t *textarea);
+
 // ----- Manual Control Tab Functions -----
 
 /**
@@ -137,6 +211,38 @@ void ui_create_scenes_tab(lv_obj_t *parent);
  */
 void ui_scenes_load_from_sd(const ui_scene_t *scenes, size_t count);
 
+/**
+ * @brief Update one scene in place (LVGL context)
+ *
+ * Only that card is re-rendered; selection and scroll position are kept.
+ *
+ * @param index Scene index
+ * @param scene New scene data
+ */
+void ui_scenes_update_scene(size_t index, const ui_scene_t *scene);
+
+/**
+ * @brief Move one scene to a new position (LVGL context)
+ *
+ * Mirrors scene_storage_reorder(). Cards keep their rendered images and the
+ * selection follows the selected scene; the scroll position is kept.
+ *
+ * @param from_index Current position
+ * @param to_index Target position
+ */
+void ui_scenes_move_scene(size_t from_index, size_t to_index);
+
+/**
+ * @brief Remove one scene (LVGL context)
+ *
+ * Cards after it shift left without re-rendering. If the selected scene is
+ * removed, its neighbour is selected; the scroll position is kept unless it
+ * is past the new last card.
+ *
+ * @param index Scene index
+ */
+void ui_scenes_remove_scene(size_t index);
+
 /**
  * @brief Update transition progress bar (FR-043)
  * 
@@ -147,11 +253,22 @@ void ui_scenes_update_progress(uint8_t percent);
 /**
  * @brief Start the progress bar tracking for a fade in progress
  * 
- * Shows the progress bar and starts a timer to update it
- * based on the fade controller's progress.
+ * Shows the progress bar at 0%. It then follows
+ * ui_scenes_notify_fade_progress() and hides when the fade ends.
  */
 void ui_scenes_start_progress_tracking(void);
 
+/**
+ * @brief Publish fade progress to the progress bar (any task)
+ * 
+ * Called by the fade controller when the whole percent changes and once
+ * when the fade ends. Only the newest value is applied, in LVGL context.
+ * 
+ * @param percent Progress across all segments (0-100)
+ * @param done true once the fade has completed or been aborted
+ */
+void ui_scenes_notify_fade_progress(uint8_t percent, bool done);
+
 /**
  * @brief Get current selected scene index
  */
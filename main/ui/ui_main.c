@@ -6,7 +6,9 @@
  */
 
 #include "ui_common.h"
+#include "ui_theme.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include <string.h>
 
 static const char *TAG = "ui_main";
@@ -15,6 +17,67 @@ static const char *TAG = "ui_main";
 static lv_obj_t *s_tabview = NULL;
 static lv_obj_t *s_tab_manual = NULL;
 static lv_obj_t *s_tab_scenes = NULL;
+static bool s_manual_built = false;
+
+// Shared on-screen keyboard (lv_layer_top, above any modal)
+#define UI_KEYBOARD_PREBUILD_DELAY_MS   500     ///< After the first frames are out
+static lv_obj_t *s_keyboard = NULL;
+
+/**
+ * @brief Build the Manual Control tab content on first visit
+ *
+ * Only the Scene Selector (the tab shown at boot) is built while the
+ * main screen is created.
+ */
+static void ensure_manual_tab(void)
+{
+    if (s_manual_built) {
+        return;
+    }
+
+    int64_t start_us = esp_timer_get_time();
+    ui_create_manual_tab(s_tab_manual);
+    s_manual_built = true;
+    ESP_LOGI(TAG, "Manual Control tab built on first visit in %lld us",
+             (long long)(esp_timer_get_time() - start_us));
+}
+
+/**
+ * @brief Tab selected (button tap or swipe end)
+ */
+static void tabview_changed_cb(lv_event_t *e)
+{
+    if (lv_obj_get_index(s_tab_manual) == lv_tabview_get_tab_act(s_tabview)) {
+        ensure_manual_tab();
+    }
+}
+
+/**
+ * @brief Swipe between tabs started - build before the tab scrolls into view
+ */
+static void tab_content_scroll_begin_cb(lv_event_t *e)
+{
+    ensure_manual_tab();
+}
+
+static void keyboard_create(void)
+{
+    int64_t start_us = esp_timer_get_time();
+    s_keyboard = lv_keyboard_create(lv_layer_top());
+    lv_obj_set_width(s_keyboard, LV_PCT(100));
+    lv_obj_add_flag(s_keyboard, LV_OBJ_FLAG_HIDDEN);
+    ESP_LOGI(TAG, "Keyboard built in %lld us", (long long)(esp_timer_get_time() - start_us));
+}
+
+/**
+ * @brief Idle-time keyboard build, so the first modal does not pay for it
+ */
+static void keyboard_prebuild_timer_cb(lv_timer_t *timer)
+{
+    if (!s_keyboard) {
+        keyboard_create();
+    }
+}
 
 /**
  * @brief Create the main screen with tabview
@@ -25,6 +88,9 @@ void ui_create_main_screen(void)
 
     ui_lock();
 
+    // Shared styles must exist before any tab content is created
+    ui_theme_init();
+
     // Get the active screen
     lv_obj_t *scr = lv_scr_act();
 
@@ -62,9 +128,19 @@ void ui_create_main_screen(void)
     lv_obj_set_style_bg_color(s_tab_scenes, lv_color_make(245, 245, 245), LV_PART_MAIN);  // #F5F5F5
     lv_obj_set_style_bg_color(s_tab_manual, lv_color_make(245, 245, 245), LV_PART_MAIN);
 
-    // Create content for each tab
+    // Scene Selector is shown first; Manual Control is built on first visit
     ui_create_scenes_tab(s_tab_scenes);
-    ui_create_manual_tab(s_tab_manual);
+    s_manual_built = false;
+    lv_obj_add_event_cb(s_tabview, tabview_changed_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    lv_obj_add_event_cb(lv_tabview_get_content(s_tabview), tab_content_scroll_begin_cb,
+                        LV_EVENT_SCROLL_BEGIN, NULL);
+
+    // The keyboard lives on lv_layer_top() and survives the screen clean
+    if (!s_keyboard) {
+        lv_timer_t *timer = lv_timer_create(keyboard_prebuild_timer_cb,
+                                            UI_KEYBOARD_PREBUILD_DELAY_MS, NULL);
+        lv_timer_set_repeat_count(timer, 1);
+    }
 
     ESP_LOGI(TAG, "Main screen created");
 
@@ -95,3 +171,30 @@ void ui_show_main(void)
     ESP_LOGI(TAG, "Showing main screen");
     ui_create_main_screen();
 }
+
+void ui_keyboard_show_no_lock(lv_obj_t *textarea, lv_coord_t height)
+{
+    if (!s_keyboard) {
+        keyboard_create();
+    }
+
+    lv_obj_set_height(s_keyboard, height);
+    lv_obj_align(s_keyboard, LV_ALIGN_BOTTOM_MID, 0, 0);
+    lv_keyboard_set_textarea(s_keyboard, textarea);
+    lv_obj_clear_flag(s_keyboard, LV_OBJ_FLAG_HIDDEN);
+}
+
+void ui_keyboard_hide_no_lock(void)
+{
+    if (s_keyboard) {
+        lv_obj_add_flag(s_keyboard, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void ui_keyboard_release_no_lock(lv_obj_t *textarea)
+{
+    if (s_keyboard && lv_keyboard_get_textarea(s_keyboard) == textarea) {
+        lv_keyboard_set_textarea(s_keyboard, NULL);
+        lv_obj_add_flag(s_keyboard, LV_OBJ_FLAG_HIDDEN);
+    }
+}
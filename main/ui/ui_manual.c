@@ -7,12 +7,19 @@
  * - FR-021: No CAN traffic until Update is pressed
  * - FR-022: Update transmits all parameters respecting rate limits
  * - FR-023: Save Scene opens modal dialog with Save and Cancel
+ * 
+ * The R/G/B/W sliders can be swapped for a hue/saturation colour wheel. The
+ * wheel is rendered once into a PSRAM canvas; dragging only moves a cursor.
  */
 
 #include "ui_common.h"
+#include "ui_theme.h"
 #include "../app/scene_storage.h"
 #include "../app/fade_controller.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include <math.h>
 #include <stdio.h>
 
 static const char *TAG = "ui_manual";
@@ -49,10 +56,24 @@ static lv_obj_t *s_btn_update = NULL;
 static lv_obj_t *s_btn_save_scene = NULL;
 static lv_obj_t *s_color_preview = NULL;
 
+static lv_obj_t *s_btn_mode = NULL;
+static lv_obj_t *s_label_mode = NULL;
+
+// Colour wheel (the canvas buffer survives a rebuild of the tab)
+static lv_obj_t *s_wheel = NULL;
+static lv_obj_t *s_wheel_cursor = NULL;
+static lv_color_t *s_wheel_buf = NULL;
+static bool s_wheel_mode = false;
+
+#define WHEEL_SIZE              280     ///< Wheel diameter (px)
+#define WHEEL_CURSOR_SIZE       28      ///< Cursor ring diameter (px)
+#define WHEEL_BG_COLOR          lv_color_make(245, 245, 245)    ///< Tab background (see ui_main.c)
+
 // Save Scene modal objects
 static lv_obj_t *s_save_modal = NULL;
 static lv_obj_t *s_save_textarea = NULL;
-static lv_obj_t *s_save_keyboard = NULL;
+
+#define SAVE_KEYBOARD_HEIGHT    240
 
 /**
  * @brief Close the save scene modal
@@ -60,10 +81,10 @@ static lv_obj_t *s_save_keyboard = NULL;
 static void close_save_modal(void)
 {
     if (s_save_modal) {
+        ui_keyboard_release_no_lock(s_save_textarea);
         lv_obj_del(s_save_modal);
         s_save_modal = NULL;
         s_save_textarea = NULL;
-        s_save_keyboard = NULL;
     }
 }
 
@@ -115,14 +136,9 @@ static void textarea_event_cb(lv_event_t *e)
     lv_obj_t *ta = lv_event_get_target(e);
     
     if (code == LV_EVENT_FOCUSED) {
-        if (s_save_keyboard) {
-            lv_keyboard_set_textarea(s_save_keyboard, ta);
-            lv_obj_clear_flag(s_save_keyboard, LV_OBJ_FLAG_HIDDEN);
-        }
+        ui_keyboard_show_no_lock(ta, SAVE_KEYBOARD_HEIGHT);
     } else if (code == LV_EVENT_DEFOCUSED) {
-        if (s_save_keyboard) {
-            lv_obj_add_flag(s_save_keyboard, LV_OBJ_FLAG_HIDDEN);
-        }
+        ui_keyboard_hide_no_lock();
     } else if (code == LV_EVENT_READY) {
         // Enter pressed on keyboard - trigger save
         modal_save_btn_cb(e);
@@ -134,37 +150,32 @@ static void textarea_event_cb(lv_event_t *e)
  */
 static void show_save_scene_modal(void)
 {
+    int64_t start_us = esp_timer_get_time();
+    
     // Create modal background (semi-transparent overlay)
     s_save_modal = lv_obj_create(lv_scr_act());
     lv_obj_set_size(s_save_modal, 800, 480);
     lv_obj_center(s_save_modal);
-    lv_obj_set_style_bg_color(s_save_modal, lv_color_make(0, 0, 0), LV_PART_MAIN);
-    lv_obj_set_style_bg_opa(s_save_modal, LV_OPA_50, LV_PART_MAIN);
-    lv_obj_set_style_border_width(s_save_modal, 0, LV_PART_MAIN);
-    lv_obj_set_style_radius(s_save_modal, 0, LV_PART_MAIN);
+    lv_obj_add_style(s_save_modal, ui_style(UI_STYLE_MODAL_OVERLAY), LV_PART_MAIN);
     
     // Create dialog box
     lv_obj_t *dialog = lv_obj_create(s_save_modal);
     lv_obj_set_size(dialog, 500, 320);
     lv_obj_align(dialog, LV_ALIGN_TOP_MID, 0, 20);
-    lv_obj_set_style_bg_color(dialog, lv_color_make(255, 255, 255), LV_PART_MAIN);
-    lv_obj_set_style_radius(dialog, 12, LV_PART_MAIN);
-    lv_obj_set_style_shadow_width(dialog, 20, LV_PART_MAIN);
-    lv_obj_set_style_shadow_opa(dialog, LV_OPA_30, LV_PART_MAIN);
-    lv_obj_set_style_pad_all(dialog, 20, LV_PART_MAIN);
+    lv_obj_add_style(dialog, ui_style(UI_STYLE_MODAL_DIALOG), LV_PART_MAIN);
     
     // Title
     lv_obj_t *title = lv_label_create(dialog);
     lv_label_set_text(title, "Save Scene");
-    lv_obj_set_style_text_font(title, &lv_font_montserrat_32, LV_PART_MAIN);
-    lv_obj_set_style_text_color(title, lv_color_make(33, 33, 33), LV_PART_MAIN);
+    lv_obj_add_style(title, ui_style(UI_STYLE_FONT_32), LV_PART_MAIN);
+    lv_obj_add_style(title, ui_style(UI_STYLE_TEXT), LV_PART_MAIN);
     lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 0);
     
     // Scene name label
     lv_obj_t *name_label = lv_label_create(dialog);
     lv_label_set_text(name_label, "Scene Name:");
-    lv_obj_set_style_text_font(name_label, &lv_font_montserrat_20, LV_PART_MAIN);
-    lv_obj_set_style_text_color(name_label, lv_color_make(97, 97, 97), LV_PART_MAIN);
+    lv_obj_add_style(name_label, ui_style(UI_STYLE_FONT_20), LV_PART_MAIN);
+    lv_obj_add_style(name_label, ui_style(UI_STYLE_TEXT_SECONDARY), LV_PART_MAIN);
     lv_obj_align(name_label, LV_ALIGN_TOP_LEFT, 0, 50);
     
     // Text input for scene name
@@ -173,10 +184,8 @@ static void show_save_scene_modal(void)
     lv_textarea_set_placeholder_text(s_save_textarea, "Enter scene name...");
     lv_obj_set_size(s_save_textarea, 440, 50);
     lv_obj_align(s_save_textarea, LV_ALIGN_TOP_LEFT, 0, 80);
-    lv_obj_set_style_text_font(s_save_textarea, &lv_font_montserrat_24, LV_PART_MAIN);
-    lv_obj_set_style_border_color(s_save_textarea, lv_color_make(189, 189, 189), LV_PART_MAIN);
-    lv_obj_set_style_border_width(s_save_textarea, 2, LV_PART_MAIN);
-    lv_obj_set_style_radius(s_save_textarea, 8, LV_PART_MAIN);
+    lv_obj_add_style(s_save_textarea, ui_style(UI_STYLE_TEXTAREA), LV_PART_MAIN);
+    lv_obj_add_style(s_save_textarea, ui_style(UI_STYLE_FONT_24), LV_PART_MAIN);
     lv_obj_add_event_cb(s_save_textarea, textarea_event_cb, LV_EVENT_ALL, NULL);
     
     // Current values display
@@ -186,17 +195,15 @@ static void show_save_scene_modal(void)
              s_manual_state.blue, s_manual_state.white);
     lv_obj_t *values_label = lv_label_create(dialog);
     lv_label_set_text(values_label, values_buf);
-    lv_obj_set_style_text_font(values_label, &lv_font_montserrat_18, LV_PART_MAIN);
-    lv_obj_set_style_text_color(values_label, lv_color_make(117, 117, 117), LV_PART_MAIN);
+    lv_obj_add_style(values_label, ui_style(UI_STYLE_FONT_18), LV_PART_MAIN);
+    lv_obj_add_style(values_label, ui_style(UI_STYLE_TEXT_MUTED), LV_PART_MAIN);
     lv_obj_align(values_label, LV_ALIGN_TOP_LEFT, 0, 140);
     
     // Button container
     lv_obj_t *btn_container = lv_obj_create(dialog);
     lv_obj_set_size(btn_container, 440, 70);
     lv_obj_align(btn_container, LV_ALIGN_BOTTOM_MID, 0, 0);
-    lv_obj_set_style_bg_opa(btn_container, LV_OPA_TRANSP, LV_PART_MAIN);
-    lv_obj_set_style_border_width(btn_container, 0, LV_PART_MAIN);
-    lv_obj_set_style_pad_all(btn_container, 0, LV_PART_MAIN);
+    lv_obj_add_style(btn_container, ui_style(UI_STYLE_CONTAINER), LV_PART_MAIN);
     lv_obj_set_flex_flow(btn_container, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(btn_container, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
@@ -204,39 +211,78 @@ static void show_save_scene_modal(void)
     lv_obj_t *btn_cancel = lv_btn_create(btn_container);
     lv_obj_set_size(btn_cancel, 180, 55);
     lv_obj_add_event_cb(btn_cancel, modal_cancel_btn_cb, LV_EVENT_CLICKED, NULL);
-    lv_obj_set_style_bg_color(btn_cancel, lv_color_make(158, 158, 158), LV_PART_MAIN);
-    lv_obj_set_style_radius(btn_cancel, 8, LV_PART_MAIN);
+    ui_theme_style_btn(btn_cancel, UI_STYLE_BTN_GRAY, UI_STYLE_FONT_24);
     
     lv_obj_t *cancel_label = lv_label_create(btn_cancel);
     lv_label_set_text(cancel_label, LV_SYMBOL_CLOSE " Cancel");
-    lv_obj_set_style_text_font(cancel_label, &lv_font_montserrat_24, LV_PART_MAIN);
-    lv_obj_set_style_text_color(cancel_label, lv_color_make(255, 255, 255), LV_PART_MAIN);
     lv_obj_center(cancel_label);
     
     // Save button
     lv_obj_t *btn_save = lv_btn_create(btn_container);
     lv_obj_set_size(btn_save, 180, 55);
     lv_obj_add_event_cb(btn_save, modal_save_btn_cb, LV_EVENT_CLICKED, NULL);
-    lv_obj_set_style_bg_color(btn_save, lv_color_make(76, 175, 80), LV_PART_MAIN);
-    lv_obj_set_style_radius(btn_save, 8, LV_PART_MAIN);
+    ui_theme_style_btn(btn_save, UI_STYLE_BTN_GREEN, UI_STYLE_FONT_24);
     
     lv_obj_t *save_label = lv_label_create(btn_save);
     lv_label_set_text(save_label, LV_SYMBOL_OK " Save");
-    lv_obj_set_style_text_font(save_label, &lv_font_montserrat_24, LV_PART_MAIN);
-    lv_obj_set_style_text_color(save_label, lv_color_make(255, 255, 255), LV_PART_MAIN);
     lv_obj_center(save_label);
     
-    // Create keyboard at bottom of modal (full width, taller)
-    s_save_keyboard = lv_keyboard_create(s_save_modal);
-    lv_obj_set_size(s_save_keyboard, 800, 240);
-    lv_obj_align(s_save_keyboard, LV_ALIGN_BOTTOM_MID, 0, 0);
-    lv_keyboard_set_textarea(s_save_keyboard, s_save_textarea);
-    lv_obj_add_flag(s_save_keyboard, LV_OBJ_FLAG_HIDDEN);  // Hidden until textarea focused
-    
-    // Focus the textarea to show keyboard
+    // The shared keyboard is shown when the textarea is focused
     lv_obj_add_state(s_save_textarea, LV_STATE_FOCUSED);
+    
+    ESP_LOGI(TAG, "Save modal created in %lld us", (long long)(esp_timer_get_time() - start_us));
 }
 
+/**
+ * @brief Preview intensity for each brightness: isqrt(brightness * 255)
+ * 
+ * Gamma 0.5 keeps colours visible at low brightness (brightness=64 -> 50%).
+ * Values are the integer square root rounded down.
+ */
+static const uint8_t s_preview_intensity[256] = {
+      0,  15,  22,  27,  31,  35,  39,  42,  45,  47,  50,  52,  55,  57,  59,  61,
+     63,  65,  67,  69,  71,  73,  74,  76,  78,  79,  81,  82,  84,  85,  87,  88,
+     90,  91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 104, 105, 107, 108, 109,
+    110, 111, 112, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126,
+    127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 141,
+    142, 143, 144, 145, 146, 147, 148, 148, 149, 150, 151, 152, 153, 153, 154, 155,
+    156, 157, 158, 158, 159, 160, 161, 162, 162, 163, 164, 165, 165, 166, 167, 168,
+    168, 169, 170, 171, 171, 172, 173, 174, 174, 175, 176, 177, 177, 178, 179, 179,
+    180, 181, 182, 182, 183, 184, 184, 185, 186, 186, 187, 188, 188, 189, 190, 190,
+    191, 192, 192, 193, 194, 194, 195, 196, 196, 197, 198, 198, 199, 200, 200, 201,
+    201, 202, 203, 203, 204, 205, 205, 206, 206, 207, 208, 208, 209, 210, 210, 211,
+    211, 212, 213, 213, 214, 214, 215, 216, 216, 217, 217, 218, 218, 219, 220, 220,
+    221, 221, 222, 222, 223, 224, 224, 225, 225, 226, 226, 227, 228, 228, 229, 229,
+    230, 230, 231, 231, 232, 233, 233, 234, 234, 235, 235, 236, 236, 237, 237, 238,
+    238, 239, 240, 240, 241, 241, 242, 242, 243, 243, 244, 244, 245, 245, 246, 246,
+    247, 247, 248, 248, 249, 249, 250, 250, 251, 251, 252, 252, 253, 253, 254, 255,
+};
+
+/**
+ * @brief White blend factor for each white value: ceil(w * 65536 / 320)
+ * 
+ * (x * s_preview_white_blend[w]) >> 16 equals x * w / 320 (rounded down)
+ * for every x and w in 0-255.
+ */
+static const uint16_t s_preview_white_blend[256] = {
+        0,   205,   410,   615,   820,  1024,  1229,  1434,  1639,  1844,  2048,  2253,  2458,  2663,  2868,  3072,
+     3277,  3482,  3687,  3892,  4096,  4301,  4506,  4711,  4916,  5120,  5325,  5530,  5735,  5940,  6144,  6349,
+     6554,  6759,  6964,  7168,  7373,  7578,  7783,  7988,  8192,  8397,  8602,  8807,  9012,  9216,  9421,  9626,
+     9831, 10036, 10240, 10445, 10650, 10855, 11060, 11264, 11469, 11674, 11879, 12084, 12288, 12493, 12698, 12903,
+    13108, 13312, 13517, 13722, 13927, 14132, 14336, 14541, 14746, 14951, 15156, 15360, 15565, 15770, 15975, 16180,
+    16384, 16589, 16794, 16999, 17204, 17408, 17613, 17818, 18023, 18228, 18432, 18637, 18842, 19047, 19252, 19456,
+    19661, 19866, 20071, 20276, 20480, 20685, 20890, 21095, 21300, 21504, 21709, 21914, 22119, 22324, 22528, 22733,
+    22938, 23143, 23348, 23552, 23757, 23962, 24167, 24372, 24576, 24781, 24986, 25191, 25396, 25600, 25805, 26010,
+    26215, 26420, 26624, 26829, 27034, 27239, 27444, 27648, 27853, 28058, 28263, 28468, 28672, 28877, 29082, 29287,
+    29492, 29696, 29901, 30106, 30311, 30516, 30720, 30925, 31130, 31335, 31540, 31744, 31949, 32154, 32359, 32564,
+    32768, 32973, 33178, 33383, 33588, 33792, 33997, 34202, 34407, 34612, 34816, 35021, 35226, 35431, 35636, 35840,
+    36045, 36250, 36455, 36660, 36864, 37069, 37274, 37479, 37684, 37888, 38093, 38298, 38503, 38708, 38912, 39117,
+    39322, 39527, 39732, 39936, 40141, 40346, 40551, 40756, 40960, 41165, 41370, 41575, 41780, 41984, 42189, 42394,
+    42599, 42804, 43008, 43213, 43418, 43623, 43828, 44032, 44237, 44442, 44647, 44852, 45056, 45261, 45466, 45671,
+    45876, 46080, 46285, 46490, 46695, 46900, 47104, 47309, 47514, 47719, 47924, 48128, 48333, 48538, 48743, 48948,
+    49152, 49357, 49562, 49767, 49972, 50176, 50381, 50586, 50791, 50996, 51200, 51405, 51610, 51815, 52020, 52224,
+};
+
 /**
  * @brief Calculate display RGB from RGBW + brightness (additive light mixing)
  * 
@@ -245,6 +291,8 @@ static void show_save_scene_modal(void)
  * - White LED blends towards white, but doesn't completely wash out color
  * - Brightness acts as intensity using gamma curve for perceptual accuracy
  * 
+ * Table driven: two lookups, then multiplies and shifts only.
+ * 
  * @param brightness Master brightness (0-255)
  * @param r Red channel (0-255)
  * @param g Green channel (0-255)
@@ -258,36 +306,17 @@ lv_color_t ui_calculate_preview_color(uint8_t brightness, uint8_t r, uint8_t g,
     // This keeps color visible even at high white values
     // blend_factor = w / 320 means max 80% blend towards white at w=255
     // For each channel: result = color + (255 - color) * blend_factor
-    uint16_t full_r = r + ((255 - r) * w) / 320;
-    uint16_t full_g = g + ((255 - g) * w) / 320;
-    uint16_t full_b = b + ((255 - b) * w) / 320;
-    
-    // Clamp to 255 (shouldn't be needed with /512 but for safety)
-    if (full_r > 255) full_r = 255;
-    if (full_g > 255) full_g = 255;
-    if (full_b > 255) full_b = 255;
-    
-    // Apply brightness as intensity using square root for perceptual linearity
-    // This keeps colors visible at lower brightness (like alpha/opacity)
-    // brightness=0 -> 0%, brightness=64 -> 50%, brightness=255 -> 100%
-    uint32_t b_normalized = (brightness * 255);  // 0-65025
-    uint32_t intensity = 0;
-    if (b_normalized > 0) {
-        // Integer square root using Newton-Raphson
-        uint32_t x = b_normalized;
-        uint32_t y = x;
-        while (y > (x / y)) {
-            y = (y + x / y) / 2;
-        }
-        intensity = y;
-    }
-    // intensity is now 0-255 with gamma 0.5 curve applied
+    uint32_t blend = s_preview_white_blend[w];
+    uint32_t full_r = r + (((255 - r) * blend) >> 16);
+    uint32_t full_g = g + (((255 - g) * blend) >> 16);
+    uint32_t full_b = b + (((255 - b) * blend) >> 16);
     
-    uint16_t final_r = (full_r * intensity) / 255;
-    uint16_t final_g = (full_g * intensity) / 255;
-    uint16_t final_b = (full_b * intensity) / 255;
+    // Apply brightness as intensity (see s_preview_intensity)
+    uint32_t intensity = s_preview_intensity[brightness];
     
-    return lv_color_make((uint8_t)final_r, (uint8_t)final_g, (uint8_t)final_b);
+    return lv_color_make((uint8_t)((full_r * intensity) / 255),
+                         (uint8_t)((full_g * intensity) / 255),
+                         (uint8_t)((full_b * intensity) / 255));
 }
 
 /**
@@ -343,6 +372,261 @@ static void slider_event_cb(lv_event_t *e)
     update_color_preview();
 }
 
+/**
+ * @brief Move the sliders and labels to the current state
+ */
+static void sync_sliders(void)
+{
+    if (s_slider_brightness) {
+        lv_slider_set_value(s_slider_brightness, s_manual_state.brightness, LV_ANIM_OFF);
+        update_slider_label(s_label_brightness, "Brightness", s_manual_state.brightness);
+    }
+    if (s_slider_red) {
+        lv_slider_set_value(s_slider_red, s_manual_state.red, LV_ANIM_OFF);
+        update_slider_label(s_label_red, "Red", s_manual_state.red);
+    }
+    if (s_slider_green) {
+        lv_slider_set_value(s_slider_green, s_manual_state.green, LV_ANIM_OFF);
+        update_slider_label(s_label_green, "Green", s_manual_state.green);
+    }
+    if (s_slider_blue) {
+        lv_slider_set_value(s_slider_blue, s_manual_state.blue, LV_ANIM_OFF);
+        update_slider_label(s_label_blue, "Blue", s_manual_state.blue);
+    }
+    if (s_slider_white) {
+        lv_slider_set_value(s_slider_white, s_manual_state.white, LV_ANIM_OFF);
+        update_slider_label(s_label_white, "White", s_manual_state.white);
+    }
+}
+
+/**
+ * @brief Fully bright HSV to 8-bit RGB
+ * 
+ * @param hue Hue in degrees (0-359)
+ * @param sat Saturation (0-255)
+ * @param rgb Output red, green, blue
+ */
+static void hsv_to_rgb8(uint16_t hue, uint8_t sat, uint8_t rgb[3])
+{
+    uint32_t rem = (hue % 60) * 255 / 60;
+    uint8_t p = 255 - sat;
+    uint8_t q = 255 - (sat * rem) / 255;
+    uint8_t t = 255 - (sat * (255 - rem)) / 255;
+    
+    switch (hue / 60) {
+        case 0:  rgb[0] = 255; rgb[1] = t;   rgb[2] = p;   break;
+        case 1:  rgb[0] = q;   rgb[1] = 255; rgb[2] = p;   break;
+        case 2:  rgb[0] = p;   rgb[1] = 255; rgb[2] = t;   break;
+        case 3:  rgb[0] = p;   rgb[1] = q;   rgb[2] = 255; break;
+        case 4:  rgb[0] = t;   rgb[1] = p;   rgb[2] = 255; break;
+        default: rgb[0] = 255; rgb[1] = p;   rgb[2] = q;   break;
+    }
+}
+
+/**
+ * @brief Hue (degrees, counter-clockwise from the right) of a point relative to the centre
+ */
+static uint16_t wheel_hue(float dx, float dy)
+{
+    float deg = atan2f(-dy, dx) * (180.0f / (float)M_PI);
+    if (deg < 0.0f) {
+        deg += 360.0f;
+    }
+    uint16_t hue = (uint16_t)deg;
+    return hue >= 360 ? 0 : hue;
+}
+
+/**
+ * @brief Draw the wheel into its canvas buffer (once per boot)
+ * 
+ * Hue runs around the wheel and saturation from the centre (white) to the
+ * rim. The rim is blended into the tab background over one pixel.
+ */
+static void wheel_render(void)
+{
+    int64_t start_us = esp_timer_get_time();
+    const float radius = WHEEL_SIZE / 2.0f;
+    
+    for (int y = 0; y < WHEEL_SIZE; y++) {
+        float dy = y + 0.5f - radius;
+        for (int x = 0; x < WHEEL_SIZE; x++) {
+            float dx = x + 0.5f - radius;
+            float dist = sqrtf(dx * dx + dy * dy);
+            lv_color_t color = WHEEL_BG_COLOR;
+            
+            if (dist < radius) {
+                uint8_t rgb[3];
+                uint8_t sat = dist >= radius - 1.0f ? 255 : (uint8_t)(dist * 255.0f / (radius - 1.0f));
+                hsv_to_rgb8(wheel_hue(dx, dy), sat, rgb);
+                color = lv_color_make(rgb[0], rgb[1], rgb[2]);
+                if (dist > radius - 1.0f) {
+                    color = lv_color_mix(color, WHEEL_BG_COLOR, (uint8_t)((radius - dist) * 255.0f));
+                }
+            }
+            s_wheel_buf[y * WHEEL_SIZE + x] = color;
+        }
+    }
+    
+    ESP_LOGI(TAG, "Colour wheel rendered in %lld us", (long long)(esp_timer_get_time() - start_us));
+}
+
+/**
+ * @brief Place the cursor at the hue and saturation of the current RGBW state
+ * 
+ * Inverse of wheel_pick(): the extracted white is added back to each channel.
+ */
+static void wheel_cursor_sync(void)
+{
+    if (!s_wheel_cursor) {
+        return;
+    }
+    
+    uint8_t r = LV_MIN(255, s_manual_state.red + s_manual_state.white);
+    uint8_t g = LV_MIN(255, s_manual_state.green + s_manual_state.white);
+    uint8_t b = LV_MIN(255, s_manual_state.blue + s_manual_state.white);
+    lv_color_hsv_t hsv = lv_color_rgb_to_hsv(r, g, b);
+    
+    float angle = hsv.h * ((float)M_PI / 180.0f);
+    float dist = hsv.s * (WHEEL_SIZE / 2 - 1) / 100.0f;
+    lv_coord_t x = WHEEL_SIZE / 2 + (lv_coord_t)lroundf(dist * cosf(angle));
+    lv_coord_t y = WHEEL_SIZE / 2 - (lv_coord_t)lroundf(dist * sinf(angle));
+    lv_obj_set_pos(s_wheel_cursor, x - WHEEL_CURSOR_SIZE / 2, y - WHEEL_CURSOR_SIZE / 2);
+}
+
+/**
+ * @brief Set R, G, B and W from a point on the wheel (relative to its top left)
+ * 
+ * The unsaturated part of the colour, min(R, G, B), is moved to the white
+ * channel by CONFIG_UI_COLOR_WHEEL_WHITE_PCT percent. Brightness is left to
+ * its slider.
+ */
+static void wheel_pick(lv_coord_t x, lv_coord_t y)
+{
+    const float radius = WHEEL_SIZE / 2 - 1;
+    float dx = x - WHEEL_SIZE / 2;
+    float dy = y - WHEEL_SIZE / 2;
+    float dist = sqrtf(dx * dx + dy * dy);
+    
+    // Dragging past the rim follows the rim
+    if (dist > radius) {
+        dx = dx * radius / dist;
+        dy = dy * radius / dist;
+        dist = radius;
+    }
+    
+    uint8_t rgb[3];
+    hsv_to_rgb8(wheel_hue(dx, dy), (uint8_t)(dist * 255.0f / radius), rgb);
+    uint8_t white = LV_MIN(rgb[0], LV_MIN(rgb[1], rgb[2])) * CONFIG_UI_COLOR_WHEEL_WHITE_PCT / 100;
+    
+    lv_obj_set_pos(s_wheel_cursor,
+                   WHEEL_SIZE / 2 + (lv_coord_t)lroundf(dx) - WHEEL_CURSOR_SIZE / 2,
+                   WHEEL_SIZE / 2 + (lv_coord_t)lroundf(dy) - WHEEL_CURSOR_SIZE / 2);
+    
+    if (rgb[0] - white == s_manual_state.red && rgb[1] - white == s_manual_state.green &&
+        rgb[2] - white == s_manual_state.blue && white == s_manual_state.white) {
+        return;
+    }
+    s_manual_state.red = rgb[0] - white;
+    s_manual_state.green = rgb[1] - white;
+    s_manual_state.blue = rgb[2] - white;
+    s_manual_state.white = white;
+    update_color_preview();
+}
+
+/**
+ * @brief Wheel pressed or dragged
+ */
+static void wheel_event_cb(lv_event_t *e)
+{
+    lv_point_t point;
+    lv_area_t coords;
+    lv_indev_get_point(lv_indev_get_act(), &point);
+    lv_obj_get_coords(s_wheel, &coords);
+    wheel_pick(point.x - coords.x1, point.y - coords.y1);
+}
+
+/**
+ * @brief Create the wheel canvas and its cursor (first switch to wheel mode)
+ */
+static bool wheel_create(lv_obj_t *parent)
+{
+    bool render = false;
+    if (!s_wheel_buf) {
+        s_wheel_buf = heap_caps_malloc(LV_CANVAS_BUF_SIZE_TRUE_COLOR(WHEEL_SIZE, WHEEL_SIZE),
+                                       MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!s_wheel_buf) {
+            ESP_LOGE(TAG, "Failed to allocate colour wheel");
+            return false;
+        }
+        render = true;
+    }
+    
+    s_wheel = lv_canvas_create(parent);
+    lv_canvas_set_buffer(s_wheel, s_wheel_buf, WHEEL_SIZE, WHEEL_SIZE, LV_IMG_CF_TRUE_COLOR);
+    lv_obj_align(s_wheel, LV_ALIGN_TOP_LEFT, 20, 85);
+    lv_obj_add_flag(s_wheel, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_clear_flag(s_wheel, LV_OBJ_FLAG_SCROLL_CHAIN);  // Dragging must not swipe the tabs
+    lv_obj_clear_flag(s_wheel, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(s_wheel, LV_OBJ_FLAG_OVERFLOW_VISIBLE);  // Cursor overhangs the rim
+    lv_obj_add_event_cb(s_wheel, wheel_event_cb, LV_EVENT_PRESSED, NULL);
+    lv_obj_add_event_cb(s_wheel, wheel_event_cb, LV_EVENT_PRESSING, NULL);
+    if (render) {
+        wheel_render();
+    }
+    
+    // Hollow ring: moving it redraws only its own area of the canvas
+    s_wheel_cursor = lv_obj_create(s_wheel);
+    lv_obj_remove_style_all(s_wheel_cursor);
+    lv_obj_set_size(s_wheel_cursor, WHEEL_CURSOR_SIZE, WHEEL_CURSOR_SIZE);
+    lv_obj_add_style(s_wheel_cursor, ui_style(UI_STYLE_WHEEL_CURSOR), LV_PART_MAIN);
+    lv_obj_clear_flag(s_wheel_cursor, LV_OBJ_FLAG_CLICKABLE);
+    return true;
+}
+
+/**
+ * @brief Show the colour wheel or the R/G/B/W sliders
+ */
+static void set_wheel_mode(bool wheel)
+{
+    if (wheel && !s_wheel && !wheel_create(lv_obj_get_parent(s_btn_mode))) {
+        return;
+    }
+    s_wheel_mode = wheel;
+    
+    lv_obj_t *rgbw[] = {
+        s_label_red, s_slider_red, s_label_green, s_slider_green,
+        s_label_blue, s_slider_blue, s_label_white, s_slider_white,
+    };
+    for (size_t i = 0; i < sizeof(rgbw) / sizeof(rgbw[0]); i++) {
+        if (wheel) {
+            lv_obj_add_flag(rgbw[i], LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_clear_flag(rgbw[i], LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+    
+    if (wheel) {
+        lv_obj_clear_flag(s_wheel, LV_OBJ_FLAG_HIDDEN);
+        wheel_cursor_sync();
+        lv_label_set_text(s_label_mode, LV_SYMBOL_LIST " Sliders");
+    } else {
+        if (s_wheel) {
+            lv_obj_add_flag(s_wheel, LV_OBJ_FLAG_HIDDEN);
+        }
+        // The sliders were not updated while the wheel was in use
+        sync_sliders();
+        lv_label_set_text(s_label_mode, LV_SYMBOL_IMAGE " Wheel");
+    }
+}
+
+/**
+ * @brief Wheel/Sliders button event handler
+ */
+static void mode_btn_event_cb(lv_event_t *e)
+{
+    set_wheel_mode(!s_wheel_mode);
+}
+
 /**
  * @brief Update button event handler (FR-022)
  */
@@ -389,8 +673,7 @@ static lv_obj_t* create_labeled_slider(lv_obj_t *parent, const char *label_text,
     char buf[32];
     snprintf(buf, sizeof(buf), "%s: %d", label_text, initial_value);
     lv_label_set_text(label, buf);
-    lv_obj_set_style_text_font(label, &lv_font_montserrat_28, LV_PART_MAIN);
-    lv_obj_set_style_text_color(label, lv_color_hex(0x0000), LV_PART_MAIN);  // Black text
+    lv_obj_add_style(label, ui_style(UI_STYLE_FONT_28), LV_PART_MAIN);  // Black text from the tabview
     lv_obj_align(label, LV_ALIGN_TOP_LEFT, 20, y_pos);
     
     // Create slider (with increased spacing from label)
@@ -401,12 +684,11 @@ static lv_obj_t* create_labeled_slider(lv_obj_t *parent, const char *label_text,
     lv_obj_align(slider, LV_ALIGN_TOP_LEFT, 20, y_pos + 40);  // Increased from 30 to 40
     lv_obj_add_event_cb(slider, slider_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
     
-    // Style the slider - Material Blue with darker grey background
-    lv_obj_set_style_bg_color(slider, lv_color_make(189, 189, 189), LV_PART_MAIN);  // Darker gray #BDBDBD
-    lv_obj_set_style_bg_color(slider, lv_color_make(33, 150, 243), LV_PART_INDICATOR);  // Material Blue #2196F3
-    lv_obj_set_style_bg_color(slider, lv_color_make(33, 150, 243), LV_PART_KNOB);  // Material Blue #2196F3
-    lv_obj_set_style_border_width(slider, 0, LV_PART_MAIN);
-    lv_obj_set_style_pad_all(slider, 5, LV_PART_KNOB);  // Larger knob
+    // Style the slider - Material Blue with darker grey background, larger knob
+    lv_obj_add_style(slider, ui_style(UI_STYLE_SLIDER_TRACK), LV_PART_MAIN);
+    lv_obj_add_style(slider, ui_style(UI_STYLE_SLIDER_ACCENT), LV_PART_INDICATOR);
+    lv_obj_add_style(slider, ui_style(UI_STYLE_SLIDER_ACCENT), LV_PART_KNOB);
+    lv_obj_add_style(slider, ui_style(UI_STYLE_SLIDER_KNOB_LARGE), LV_PART_KNOB);
     
     if (out_label) {
         *out_label = label;
@@ -422,6 +704,11 @@ void ui_create_manual_tab(lv_obj_t *parent)
 {
     ESP_LOGI(TAG, "Creating manual control tab");
 
+    // A rebuilt tab starts in slider mode; the wheel image is kept
+    s_wheel = NULL;
+    s_wheel_cursor = NULL;
+    s_wheel_mode = false;
+
     // Create sliders (FR-020) - positioned on left 2/3 of screen
     s_slider_brightness = create_labeled_slider(parent, "Brightness", s_manual_state.brightness, 
                                                  &s_label_brightness, 5);
@@ -434,11 +721,22 @@ void ui_create_manual_tab(lv_obj_t *parent)
     s_slider_white = create_labeled_slider(parent, "White", s_manual_state.white, 
                                             &s_label_white, 305);
 
+    // Wheel/Sliders toggle, right of the Brightness label
+    s_btn_mode = lv_btn_create(parent);
+    lv_obj_set_size(s_btn_mode, 120, 36);
+    lv_obj_align(s_btn_mode, LV_ALIGN_TOP_LEFT, 320, 0);
+    lv_obj_add_event_cb(s_btn_mode, mode_btn_event_cb, LV_EVENT_CLICKED, NULL);
+    ui_theme_style_btn(s_btn_mode, UI_STYLE_BTN_GRAY, UI_STYLE_FONT_18);
+    
+    s_label_mode = lv_label_create(s_btn_mode);
+    lv_label_set_text(s_label_mode, LV_SYMBOL_IMAGE " Wheel");
+    lv_obj_center(s_label_mode);
+
     // Create color preview circle on right side
     s_color_preview = lv_obj_create(parent);
     lv_obj_set_size(s_color_preview, 140, 140);
     lv_obj_align(s_color_preview, LV_ALIGN_TOP_RIGHT, -60, 20);
-    lv_obj_set_style_radius(s_color_preview, LV_RADIUS_CIRCLE, LV_PART_MAIN);
+    lv_obj_add_style(s_color_preview, ui_style(UI_STYLE_CIRCLE), LV_PART_MAIN);
     lv_obj_clear_flag(s_color_preview, LV_OBJ_FLAG_SCROLLABLE);
     
     // Set initial preview color
@@ -453,15 +751,11 @@ void ui_create_manual_tab(lv_obj_t *parent)
     
     lv_obj_t *label_apply = lv_label_create(s_btn_update);
     lv_label_set_text(label_apply, LV_SYMBOL_PLAY " Apply");
-    lv_obj_set_style_text_font(label_apply, &lv_font_montserrat_28, LV_PART_MAIN);
     lv_obj_center(label_apply);
     
     // Style Apply button - Material Green
-    lv_obj_set_style_bg_color(s_btn_update, lv_color_make(76, 175, 80), LV_PART_MAIN);  // Material Green #4CAF50
-    lv_obj_set_style_bg_opa(s_btn_update, LV_OPA_COVER, LV_PART_MAIN);  // Ensure full opacity
-    lv_obj_set_style_text_color(label_apply, lv_color_make(255, 255, 255), LV_PART_MAIN);  // White
-    lv_obj_set_style_shadow_width(s_btn_update, 4, LV_PART_MAIN);
-    lv_obj_set_style_shadow_opa(s_btn_update, LV_OPA_30, LV_PART_MAIN);
+    ui_theme_style_btn(s_btn_update, UI_STYLE_BTN_GREEN, UI_STYLE_FONT_28);
+    lv_obj_add_style(s_btn_update, ui_style(UI_STYLE_BTN_RAISED), LV_PART_MAIN);
 
     // Save Scene button (FR-023) - below Apply button
     s_btn_save_scene = lv_btn_create(parent);
@@ -471,15 +765,11 @@ void ui_create_manual_tab(lv_obj_t *parent)
     
     lv_obj_t *label_save = lv_label_create(s_btn_save_scene);
     lv_label_set_text(label_save, LV_SYMBOL_SAVE " Save Scene");
-    lv_obj_set_style_text_font(label_save, &lv_font_montserrat_28, LV_PART_MAIN);
     lv_obj_center(label_save);
     
     // Style Save Scene button - Material Blue
-    lv_obj_set_style_bg_color(s_btn_save_scene, lv_color_make(33, 150, 243), LV_PART_MAIN);  // Material Blue #2196F3
-    lv_obj_set_style_bg_opa(s_btn_save_scene, LV_OPA_COVER, LV_PART_MAIN);  // Ensure full opacity
-    lv_obj_set_style_text_color(label_save, lv_color_make(255, 255, 255), LV_PART_MAIN);  // White
-    lv_obj_set_style_shadow_width(s_btn_save_scene, 4, LV_PART_MAIN);
-    lv_obj_set_style_shadow_opa(s_btn_save_scene, LV_OPA_30, LV_PART_MAIN);
+    ui_theme_style_btn(s_btn_save_scene, UI_STYLE_BTN_BLUE, UI_STYLE_FONT_28);
+    lv_obj_add_style(s_btn_save_scene, ui_style(UI_STYLE_BTN_RAISED), LV_PART_MAIN);
 
     ESP_LOGI(TAG, "Manual control tab created");
 }
@@ -511,25 +801,9 @@ void ui_manual_set_values(uint8_t brightness, uint8_t red, uint8_t green,
     s_manual_state.blue = blue;
     s_manual_state.white = white;
 
-    if (s_slider_brightness) {
-        lv_slider_set_value(s_slider_brightness, brightness, LV_ANIM_OFF);
-        update_slider_label(s_label_brightness, "Brightness", brightness);
-    }
-    if (s_slider_red) {
-        lv_slider_set_value(s_slider_red, red, LV_ANIM_OFF);
-        update_slider_label(s_label_red, "Red", red);
-    }
-    if (s_slider_green) {
-        lv_slider_set_value(s_slider_green, green, LV_ANIM_OFF);
-        update_slider_label(s_label_green, "Green", green);
-    }
-    if (s_slider_blue) {
-        lv_slider_set_value(s_slider_blue, blue, LV_ANIM_OFF);
-        update_slider_label(s_label_blue, "Blue", blue);
-    }
-    if (s_slider_white) {
-        lv_slider_set_value(s_slider_white, white, LV_ANIM_OFF);
-        update_slider_label(s_label_white, "White", white);
+    sync_sliders();
+    if (s_wheel_mode) {
+        wheel_cursor_sync();
     }
     
     // Update color preview circle
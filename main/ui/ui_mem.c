@@ -0,0 +1,182 @@
+/**
+ * @file ui_mem.c
+ * @brief Tiered LVGL allocator (internal pool for small blocks, PSRAM for large)
+ */
+
+#include "ui_mem.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "multi_heap.h"
+#include "freertos/FreeRTOS.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "ui_mem";
+
+#define UI_MEM_PSRAM_CAPS   (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+
+// Internal pool (created on LVGL's first allocation, in lv_init())
+static multi_heap_handle_t s_pool = NULL;
+static uint8_t *s_pool_mem = NULL;
+static size_t s_pool_size = 0;
+static bool s_pool_tried = false;
+static portMUX_TYPE s_pool_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// PSRAM tier and overflow counters
+static portMUX_TYPE s_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+static size_t s_psram_used = 0;
+static size_t s_psram_peak = 0;
+static uint32_t s_pool_overflows = 0;
+
+static void pool_init(void)
+{
+    s_pool_tried = true;
+    size_t size = CONFIG_LVGL_MEM_POOL_KB * 1024;
+    if (size == 0) {
+        ESP_LOGI(TAG, "Internal pool disabled, all LVGL allocations in PSRAM");
+        return;
+    }
+
+    s_pool_mem = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (s_pool_mem) {
+        s_pool = multi_heap_register(s_pool_mem, size);
+    }
+    if (!s_pool) {
+        ESP_LOGW(TAG, "Failed to create %u KB internal pool, using PSRAM only",
+                 (unsigned)CONFIG_LVGL_MEM_POOL_KB);
+        heap_caps_free(s_pool_mem);
+        s_pool_mem = NULL;
+        return;
+    }
+
+    multi_heap_set_lock(s_pool, &s_pool_lock);
+    s_pool_size = multi_heap_free_size(s_pool);
+    ESP_LOGI(TAG, "Internal pool %u bytes, blocks >= %u bytes in PSRAM",
+             (unsigned)s_pool_size, (unsigned)CONFIG_LVGL_MEM_PSRAM_THRESHOLD);
+}
+
+static bool in_pool(const void *ptr)
+{
+    return s_pool_mem != NULL && (const uint8_t *)ptr >= s_pool_mem &&
+           (const uint8_t *)ptr < s_pool_mem + CONFIG_LVGL_MEM_POOL_KB * 1024;
+}
+
+static void psram_account(size_t freed, size_t allocated)
+{
+    taskENTER_CRITICAL(&s_stats_lock);
+    s_psram_used = s_psram_used - freed + allocated;
+    if (s_psram_used > s_psram_peak) {
+        s_psram_peak = s_psram_used;
+    }
+    taskEXIT_CRITICAL(&s_stats_lock);
+}
+
+static void *psram_alloc(size_t size)
+{
+    void *ptr = heap_caps_malloc(size, UI_MEM_PSRAM_CAPS);
+    if (ptr) {
+        psram_account(0, heap_caps_get_allocated_size(ptr));
+    }
+    return ptr;
+}
+
+void *ui_mem_alloc(size_t size)
+{
+    if (!s_pool_tried) {
+        pool_init();
+    }
+
+    if (s_pool && size < CONFIG_LVGL_MEM_PSRAM_THRESHOLD) {
+        void *ptr = multi_heap_malloc(s_pool, size);
+        if (ptr) {
+            return ptr;
+        }
+        taskENTER_CRITICAL(&s_stats_lock);
+        s_pool_overflows++;
+        taskEXIT_CRITICAL(&s_stats_lock);
+    }
+    return psram_alloc(size);
+}
+
+void ui_mem_free(void *ptr)
+{
+    if (ptr == NULL) {
+        return;
+    }
+
+    if (in_pool(ptr)) {
+        multi_heap_free(s_pool, ptr);
+    } else {
+        psram_account(heap_caps_get_allocated_size(ptr), 0);
+        heap_caps_free(ptr);
+    }
+}
+
+void *ui_mem_realloc(void *ptr, size_t size)
+{
+    if (ptr == NULL) {
+        return ui_mem_alloc(size);
+    }
+
+    if (in_pool(ptr)) {
+        if (size < CONFIG_LVGL_MEM_PSRAM_THRESHOLD) {
+            void *resized = multi_heap_realloc(s_pool, ptr, size);
+            if (resized) {
+                return resized;
+            }
+        }
+
+        // Grown past the threshold, or the pool is full: move to PSRAM
+        void *moved = psram_alloc(size);
+        if (moved == NULL) {
+            return NULL;
+        }
+        size_t old_size = multi_heap_get_allocated_size(s_pool, ptr);
+        memcpy(moved, ptr, old_size < size ? old_size : size);
+        multi_heap_free(s_pool, ptr);
+        return moved;
+    }
+
+    // Large blocks stay in PSRAM even when they shrink
+    size_t old_size = heap_caps_get_allocated_size(ptr);
+    void *resized = heap_caps_realloc(ptr, size, UI_MEM_PSRAM_CAPS);
+    if (resized) {
+        psram_account(old_size, heap_caps_get_allocated_size(resized));
+    }
+    return resized;
+}
+
+void ui_mem_get_stats(ui_mem_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+
+    if (s_pool) {
+        multi_heap_info_t info;
+        multi_heap_get_info(s_pool, &info);
+        stats->pool_size = s_pool_size;
+        stats->pool_used = s_pool_size - info.total_free_bytes;
+        stats->pool_peak = s_pool_size - info.minimum_free_bytes;
+        stats->pool_largest_free = info.largest_free_block;
+        stats->pool_frag_pct = info.total_free_bytes == 0 ? 0 :
+            100 - (uint32_t)((uint64_t)info.largest_free_block * 100 / info.total_free_bytes);
+    }
+
+    taskENTER_CRITICAL(&s_stats_lock);
+    stats->pool_overflows = s_pool_overflows;
+    stats->psram_used = s_psram_used;
+    stats->psram_peak = s_psram_peak;
+    taskEXIT_CRITICAL(&s_stats_lock);
+}
+
+int ui_mem_format_stats(char *buf, size_t size)
+{
+    ui_mem_stats_t stats;
+    ui_mem_get_stats(&stats);
+
+    return snprintf(buf, size, "pool %u/%u KB (peak %u, frag %u%%, overflow %u), PSRAM %u KB (peak %u)",
+                    (unsigned)(stats.pool_used / 1024), (unsigned)(stats.pool_size / 1024),
+                    (unsigned)(stats.pool_peak / 1024), (unsigned)stats.pool_frag_pct,
+                    (unsigned)stats.pool_overflows,
+                    (unsigned)(stats.psram_used / 1024), (unsigned)(stats.psram_peak / 1024));
+}
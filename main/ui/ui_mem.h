@@ -0,0 +1,73 @@
+/**
+ * @file ui_mem.h
+ * @brief Tiered LVGL allocator (internal pool for small blocks, PSRAM for large)
+ *
+ * LVGL is built with CONFIG_LV_MEM_CUSTOM=y and its LV_MEM_CUSTOM_ALLOC/
+ * FREE/REALLOC point here (see main/CMakeLists.txt):
+ * - Blocks smaller than CONFIG_LVGL_MEM_PSRAM_THRESHOLD (objects, styles,
+ *   labels, event lists) come from a private pool of CONFIG_LVGL_MEM_POOL_KB
+ *   in internal RAM, so they are fast to touch and cannot fragment the
+ *   system heap
+ * - Larger blocks (image caches, canvases, layer buffers) and small blocks
+ *   that do not fit in the pool come from PSRAM
+ *
+ * This header is included by LVGL's lv_mem.c, so it must not include lvgl.h.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Allocator statistics since boot
+ */
+typedef struct {
+    size_t pool_size;           ///< Internal pool capacity, 0 if disabled
+    size_t pool_used;           ///< Bytes allocated from the pool
+    size_t pool_peak;           ///< Highest pool_used
+    size_t pool_largest_free;   ///< Largest free block in the pool
+    uint32_t pool_frag_pct;     ///< 100 - largest free block / total free
+    uint32_t pool_overflows;    ///< Small blocks sent to PSRAM because the pool was full
+    size_t psram_used;          ///< Bytes allocated from PSRAM
+    size_t psram_peak;          ///< Highest psram_used
+} ui_mem_stats_t;
+
+/**
+ * @brief LV_MEM_CUSTOM_ALLOC
+ */
+void *ui_mem_alloc(size_t size);
+
+/**
+ * @brief LV_MEM_CUSTOM_FREE
+ */
+void ui_mem_free(void *ptr);
+
+/**
+ * @brief LV_MEM_CUSTOM_REALLOC
+ */
+void *ui_mem_realloc(void *ptr, size_t size);
+
+/**
+ * @brief Copy the allocator statistics (any task)
+ *
+ * @param stats Output
+ */
+void ui_mem_get_stats(ui_mem_stats_t *stats);
+
+/**
+ * @brief Format the statistics as one line for logs and the CDI
+ *
+ * @param buf Output buffer
+ * @param size Size of buf
+ * @return Length written (as snprintf)
+ */
+int ui_mem_format_stats(char *buf, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,343 @@
+/**
+ * @file ui_perf.c
+ * @brief LVGL pipeline profiling (overlay and log)
+ */
+
+#include "ui_perf.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "ui_perf";
+
+#define UI_PERF_WINDOW_US       1000000     ///< Statistics window
+#define UI_PERF_MAX_SAMPLES     256         ///< Samples kept per metric for p99
+
+/**
+ * @brief Measured quantities
+ */
+typedef enum {
+    PERF_HANDLER,       ///< lv_timer_handler() duration, us
+    PERF_RENDER,        ///< Refresh timer duration, us
+    PERF_FLUSH,         ///< Flush callback time per frame, us
+    PERF_GLYPH,         ///< Glyph drawing time per frame, us
+    PERF_DIRTY_PX,      ///< Dirty pixels per frame
+    PERF_TOUCH,         ///< Touch INT to end of the frame it caused, us
+    PERF_METRIC_COUNT
+} perf_metric_id_t;
+
+static const char *const s_metric_names[PERF_METRIC_COUNT] = {
+    [PERF_HANDLER] = "handler",
+    [PERF_RENDER] = "render",
+    [PERF_FLUSH] = "flush",
+    [PERF_GLYPH] = "glyph",
+    [PERF_DIRTY_PX] = "dirty px",
+    [PERF_TOUCH] = "touch",
+};
+
+/**
+ * @brief One metric within the current window
+ */
+typedef struct {
+    uint32_t samples[UI_PERF_MAX_SAMPLES];  ///< First UI_PERF_MAX_SAMPLES values
+    uint32_t count;
+    uint64_t sum;
+    uint32_t min;
+    uint32_t max;
+} perf_metric_t;
+
+/**
+ * @brief Window statistics of one metric
+ */
+typedef struct {
+    uint32_t min;
+    uint32_t avg;
+    uint32_t p99;
+} perf_summary_t;
+
+static volatile bool s_requested = false;    // Written by any task
+static bool s_enabled = false;               // LVGL task only
+
+static lv_disp_t *s_disp = NULL;
+static lv_timer_cb_t s_refr_timer_cb = NULL;
+static void (*s_draw_letter)(lv_draw_ctx_t *draw_ctx, const lv_draw_label_dsc_t *dsc,
+                             const lv_point_t *pos_p, uint32_t letter) = NULL;
+static lv_obj_t *s_overlay = NULL;
+
+static perf_metric_t *s_metrics = NULL;     // PSRAM, PERF_METRIC_COUNT entries while enabled
+static int64_t s_window_start_us = 0;
+static uint32_t s_frames = 0;
+
+static int64_t s_handler_start_us = 0;
+static int64_t s_flush_start_us = 0;
+static uint32_t s_frame_flush_us = 0;       // Flush time accumulated in the current frame
+static uint32_t s_frame_glyph_us = 0;       // Glyph drawing time accumulated in the current frame
+static int64_t s_touch_us = 0;              // Sample time of a touch not yet drawn, 0 if none
+
+static void metric_record(perf_metric_id_t id, uint32_t value)
+{
+    perf_metric_t *m = &s_metrics[id];
+    if (m->count < UI_PERF_MAX_SAMPLES) {
+        m->samples[m->count] = value;
+    }
+    if (m->count == 0 || value < m->min) {
+        m->min = value;
+    }
+    if (value > m->max) {
+        m->max = value;
+    }
+    m->sum += value;
+    m->count++;
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static perf_summary_t metric_summarize(perf_metric_t *m)
+{
+    perf_summary_t s = {0};
+    if (m->count == 0) {
+        return s;
+    }
+
+    size_t n = m->count < UI_PERF_MAX_SAMPLES ? m->count : UI_PERF_MAX_SAMPLES;
+    qsort(m->samples, n, sizeof(uint32_t), compare_u32);
+
+    // min/avg cover every sample; p99 the first UI_PERF_MAX_SAMPLES of the window
+    s.min = m->min;
+    s.avg = (uint32_t)(m->sum / m->count);
+    s.p99 = m->samples[(n * 99) / 100];
+    return s;
+}
+
+/**
+ * @brief Close the current window: log, update overlay, reset
+ */
+static void window_report(int64_t now_us)
+{
+    float seconds = (now_us - s_window_start_us) / 1000000.0f;
+    perf_summary_t sum[PERF_METRIC_COUNT];
+    for (int i = 0; i < PERF_METRIC_COUNT; i++) {
+        sum[i] = metric_summarize(&s_metrics[i]);
+    }
+
+    char text[320];
+    int len = snprintf(text, sizeof(text), "%.1f fps   min / avg / p99", s_frames / seconds);
+    for (int i = 0; i < PERF_METRIC_COUNT && len < (int)sizeof(text); i++) {
+        len += snprintf(text + len, sizeof(text) - len, "\n%-8s %6u %6u %6u%s",
+                        s_metric_names[i], (unsigned)sum[i].min, (unsigned)sum[i].avg,
+                        (unsigned)sum[i].p99, i == PERF_DIRTY_PX ? "" : " us");
+    }
+
+    if (s_frames > 0 || s_metrics[PERF_HANDLER].count > 0) {
+        ESP_LOGI(TAG, "%.1f fps | handler %u/%u/%u us | render %u/%u/%u us | "
+                 "flush %u/%u/%u us | glyph %u/%u/%u us | dirty %u/%u/%u px | touch %u/%u/%u us",
+                 s_frames / seconds,
+                 (unsigned)sum[PERF_HANDLER].min, (unsigned)sum[PERF_HANDLER].avg,
+                 (unsigned)sum[PERF_HANDLER].p99,
+                 (unsigned)sum[PERF_RENDER].min, (unsigned)sum[PERF_RENDER].avg,
+                 (unsigned)sum[PERF_RENDER].p99,
+                 (unsigned)sum[PERF_FLUSH].min, (unsigned)sum[PERF_FLUSH].avg,
+                 (unsigned)sum[PERF_FLUSH].p99,
+                 (unsigned)sum[PERF_GLYPH].min, (unsigned)sum[PERF_GLYPH].avg,
+                 (unsigned)sum[PERF_GLYPH].p99,
+                 (unsigned)sum[PERF_DIRTY_PX].min, (unsigned)sum[PERF_DIRTY_PX].avg,
+                 (unsigned)sum[PERF_DIRTY_PX].p99,
+                 (unsigned)sum[PERF_TOUCH].min, (unsigned)sum[PERF_TOUCH].avg,
+                 (unsigned)sum[PERF_TOUCH].p99);
+    }
+
+    if (s_overlay) {
+        lv_label_set_text(s_overlay, text);
+    }
+
+    memset(s_metrics, 0, PERF_METRIC_COUNT * sizeof(perf_metric_t));
+    s_frames = 0;
+    s_window_start_us = now_us;
+}
+
+/**
+ * @brief Pixels in the display's invalidated areas
+ *
+ * Taken before LVGL merges the areas, so partly overlapping areas are
+ * counted twice (LVGL already drops areas contained in another).
+ */
+static uint32_t dirty_pixels(void)
+{
+    uint32_t px = 0;
+    for (uint16_t i = 0; i < s_disp->inv_p; i++) {
+        px += lv_area_get_size(&s_disp->inv_areas[i]);
+    }
+    return px;
+}
+
+/**
+ * @brief Wrapper around LVGL's display refresh timer
+ */
+static void perf_refr_timer_cb(lv_timer_t *timer)
+{
+    if (!s_enabled || s_disp->inv_p == 0) {
+        // A touch that invalidated nothing has no frame to measure
+        s_touch_us = 0;
+        s_refr_timer_cb(timer);
+        return;
+    }
+
+    uint32_t px = dirty_pixels();
+    s_frame_flush_us = 0;
+    s_frame_glyph_us = 0;
+    int64_t start_us = esp_timer_get_time();
+
+    s_refr_timer_cb(timer);
+
+    metric_record(PERF_RENDER, (uint32_t)(esp_timer_get_time() - start_us));
+    metric_record(PERF_FLUSH, s_frame_flush_us);
+    metric_record(PERF_GLYPH, s_frame_glyph_us);
+    metric_record(PERF_DIRTY_PX, px);
+    if (s_touch_us != 0) {
+        metric_record(PERF_TOUCH, (uint32_t)(esp_timer_get_time() - s_touch_us));
+        s_touch_us = 0;
+    }
+    s_frames++;
+}
+
+/**
+ * @brief Wrapper around the draw context's letter renderer
+ *
+ * Called once per visible glyph. Card text is drawn into the card images,
+ * so during carousel scrolling this is mostly slider, button and tab text.
+ */
+static void perf_draw_letter(lv_draw_ctx_t *draw_ctx, const lv_draw_label_dsc_t *dsc,
+                             const lv_point_t *pos_p, uint32_t letter)
+{
+    if (!s_enabled) {
+        s_draw_letter(draw_ctx, dsc, pos_p, letter);
+        return;
+    }
+
+    int64_t start_us = esp_timer_get_time();
+    s_draw_letter(draw_ctx, dsc, pos_p, letter);
+    s_frame_glyph_us += (uint32_t)(esp_timer_get_time() - start_us);
+}
+
+static void overlay_create(void)
+{
+    s_overlay = lv_label_create(lv_layer_sys());
+    lv_label_set_text(s_overlay, "profiling...");
+    lv_obj_set_style_text_font(s_overlay, &lv_font_montserrat_14, LV_PART_MAIN);
+    lv_obj_set_style_text_color(s_overlay, lv_color_white(), LV_PART_MAIN);
+    lv_obj_set_style_bg_color(s_overlay, lv_color_black(), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(s_overlay, LV_OPA_70, LV_PART_MAIN);
+    lv_obj_set_style_pad_all(s_overlay, 6, LV_PART_MAIN);
+    lv_obj_align(s_overlay, LV_ALIGN_BOTTOM_LEFT, 0, 0);
+}
+
+/**
+ * @brief Apply a pending enable/disable request (LVGL task)
+ */
+static void apply_request(void)
+{
+    bool requested = s_requested;
+    if (requested == s_enabled) {
+        return;
+    }
+
+    if (requested) {
+        s_metrics = heap_caps_calloc(PERF_METRIC_COUNT, sizeof(perf_metric_t),
+                                     MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!s_metrics) {
+            ESP_LOGE(TAG, "Failed to allocate profiling buffers");
+            s_requested = false;
+            return;
+        }
+        s_frames = 0;
+        s_window_start_us = esp_timer_get_time();
+        overlay_create();
+        ESP_LOGI(TAG, "Profiling enabled");
+    } else {
+        lv_obj_del(s_overlay);
+        s_overlay = NULL;
+        heap_caps_free(s_metrics);
+        s_metrics = NULL;
+        ESP_LOGI(TAG, "Profiling disabled");
+    }
+    s_enabled = requested;
+}
+
+void ui_perf_init(lv_disp_t *disp)
+{
+    lv_timer_t *refr_timer = _lv_disp_get_refr_timer(disp);
+    if (!refr_timer) {
+        ESP_LOGW(TAG, "Display has no refresh timer, render timing unavailable");
+        return;
+    }
+
+    s_disp = disp;
+    s_refr_timer_cb = refr_timer->timer_cb;
+    refr_timer->timer_cb = perf_refr_timer_cb;
+
+    lv_draw_ctx_t *draw_ctx = disp->driver->draw_ctx;
+    if (draw_ctx && draw_ctx->draw_letter) {
+        s_draw_letter = draw_ctx->draw_letter;
+        draw_ctx->draw_letter = perf_draw_letter;
+    }
+}
+
+void ui_perf_set_enabled(bool enabled)
+{
+    s_requested = enabled;
+}
+
+bool ui_perf_is_enabled(void)
+{
+    return s_enabled;
+}
+
+void ui_perf_handler_begin(void)
+{
+    apply_request();
+    if (s_enabled) {
+        s_handler_start_us = esp_timer_get_time();
+    }
+}
+
+void ui_perf_handler_end(void)
+{
+    if (!s_enabled) {
+        return;
+    }
+
+    int64_t now_us = esp_timer_get_time();
+    metric_record(PERF_HANDLER, (uint32_t)(now_us - s_handler_start_us));
+    if (now_us - s_window_start_us >= UI_PERF_WINDOW_US) {
+        window_report(now_us);
+    }
+}
+
+void ui_perf_touch_input(int64_t sample_us)
+{
+    if (s_enabled && s_touch_us == 0) {
+        s_touch_us = sample_us;
+    }
+}
+
+void ui_perf_flush_begin(void)
+{
+    if (s_enabled) {
+        s_flush_start_us = esp_timer_get_time();
+    }
+}
+
+void ui_perf_flush_end(void)
+{
+    if (s_enabled) {
+        s_frame_flush_us += (uint32_t)(esp_timer_get_time() - s_flush_start_us);
+    }
+}
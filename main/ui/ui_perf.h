@@ -0,0 +1,80 @@
+/**
+ * @file ui_perf.h
+ * @brief LVGL pipeline profiling (overlay and log)
+ *
+ * Measures, per 1-second window:
+ * - lv_timer_handler() duration (each call of the LVGL task loop)
+ * - Render time (display refresh timer, including flushes)
+ * - Flush time per frame (lvgl_flush_cb, including any VSYNC wait)
+ * - Glyph drawing time per frame (draw context letter renderer)
+ * - Dirty-area pixels per frame
+ * - Touch-to-pixel latency: GT911 INT (or poll) to the end of the first
+ *   frame drawn after LVGL consumed the sample
+ *
+ * Each metric is reported as min/avg/p99 on an overlay on lv_layer_sys()
+ * and in the log. Profiling is off by default and can be switched at
+ * runtime (LCC CDI "Diagnostics" group); when off, the hooks cost one
+ * branch each and no sample memory is allocated.
+ */
+
+#pragma once
+
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Hook the display refresh timer and letter renderer
+ *
+ * Call from ui_init() after the display driver is registered.
+ *
+ * @param disp LVGL display
+ */
+void ui_perf_init(lv_disp_t *disp);
+
+/**
+ * @brief Request profiling on or off (any task)
+ *
+ * Takes effect at the next LVGL task iteration.
+ */
+void ui_perf_set_enabled(bool enabled);
+
+/**
+ * @brief Check whether profiling is active
+ */
+bool ui_perf_is_enabled(void);
+
+/**
+ * @brief Mark the start of an lv_timer_handler() call (LVGL task, mutex held)
+ */
+void ui_perf_handler_begin(void);
+
+/**
+ * @brief Mark the end of an lv_timer_handler() call (LVGL task, mutex held)
+ */
+void ui_perf_handler_end(void);
+
+/**
+ * @brief Report a new touch sample consumed by LVGL (LVGL task)
+ *
+ * @param sample_us esp_timer time at which the sample was taken
+ */
+void ui_perf_touch_input(int64_t sample_us);
+
+/**
+ * @brief Mark the start of a flush callback
+ */
+void ui_perf_flush_begin(void);
+
+/**
+ * @brief Mark the end of a flush callback
+ */
+void ui_perf_flush_end(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -10,10 +10,15 @@
  */
 
 #include "ui_common.h"
+#include "ui_theme.h"
 #include "../app/scene_storage.h"
 #include "../app/fade_controller.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include <stdatomic.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 static const char *TAG = "ui_scenes";
@@ -24,29 +29,64 @@ static const char *TAG = "ui_scenes";
 #define CARD_GAP        20
 #define CAROUSEL_HEIGHT 260
 
+// Card snapshot: the card's content, drawn as one image inside its border
+#define CARD_SNAPSHOT_INSET 8       ///< Clears the 16 px radius and 4 px selection border
+#define CARD_SNAPSHOT_PAD   9       ///< Content padding within the snapshot (card pad 15 + border 2)
+#define CARD_BTN_SIZE       36
+#define CARD_BTN_INSET      12      ///< Edit/delete button offset from the card's outer edge
+#define CARD_CACHE_WINDOW   3       ///< Cards rendered on each side of the centred card
+#define CARD_RENDER_PERIOD_MS 5     ///< Card render timer; one image per run
+
+// Card objects bound around the centred card (recycled while scrolling)
+#define CARD_POOL_SIZE      (2 * CARD_CACHE_WINDOW + 1)
+
 // Scene selector state
 static struct {
     int current_scene_index;
     uint16_t transition_duration_sec;
     bool transition_in_progress;
-    bool fade_started;            // True once we've seen FADE_STATE_FADING
-    bool pending_progress_start;  // Request from external task to start progress tracking
+    bool fade_started;            // True once progress of the tracked fade has arrived
     char pending_delete_name[32];  // Scene name pending deletion
 } s_scenes_state = {
     .current_scene_index = 0,
     .transition_duration_sec = 10,
     .transition_in_progress = false,
     .fade_started = false,
-    .pending_progress_start = false,
     .pending_delete_name = ""
 };
 
-// Cached scenes for card access
-static ui_scene_t s_cached_scenes[SCENE_STORAGE_MAX_SCENES];
+// Cached scenes for card access (PSRAM, grown to fit the library)
+static ui_scene_t *s_cached_scenes = NULL;
 static size_t s_cached_scene_count = 0;
 
-// Card objects array for selection highlighting
-static lv_obj_t *s_scene_cards[SCENE_STORAGE_MAX_SCENES];
+static size_t s_scene_capacity = 0;
+
+// Recycled card objects; each card's user data is its scene index, -1 if unbound
+static lv_obj_t *s_card_pool[CARD_POOL_SIZE];
+static lv_obj_t *s_carousel_spacer = NULL;     // Sets the scroll extent
+
+/**
+ * @brief A cached card image (PSRAM pixels)
+ */
+typedef struct {
+    int index;              ///< Scene index rendered, -1 if the slot is free
+    ui_scene_t scene;       ///< Scene data the image was rendered from
+    lv_img_dsc_t img;
+    uint8_t *buf;
+} card_snapshot_t;
+
+// Card image cache (CONFIG_SCENE_CARD_CACHE_SIZE slots, allocated on first use)
+static card_snapshot_t *s_card_cache = NULL;
+static uint32_t s_card_buf_size = 0;
+static lv_timer_t *s_card_render_timer = NULL;  // Paused while every image is current
+
+// Off-screen widgets that card images are rendered from
+static struct {
+    lv_obj_t *root;
+    lv_obj_t *circle;
+    lv_obj_t *name;
+    lv_obj_t *values;
+} s_card_template = {0};
 
 // UI Objects
 static lv_obj_t *s_carousel = NULL;
@@ -55,18 +95,22 @@ static lv_obj_t *s_label_duration = NULL;
 static lv_obj_t *s_btn_apply = NULL;
 static lv_obj_t *s_progress_bar = NULL;
 static lv_obj_t *s_label_no_scenes = NULL;
+static lv_obj_t *s_dropdown_category = NULL;
 
-// Progress bar update timer
-static lv_timer_t *s_progress_timer = NULL;
+// Latest fade progress from the lighting task (see ui_scenes_notify_fade_progress)
+#define FADE_PROGRESS_DONE  0x100   ///< Set in s_fade_progress once the fade has ended
+static atomic_uint s_fade_progress = 0;
+static atomic_bool s_fade_progress_queued = false;
 
 // Delete confirmation modal
 static lv_obj_t *s_delete_modal = NULL;
 
+#define EDIT_KEYBOARD_HEIGHT    200
+
 // Edit scene modal state
 static struct {
     lv_obj_t *modal;
     lv_obj_t *name_textarea;
-    lv_obj_t *keyboard;
     lv_obj_t *slider_brightness;
     lv_obj_t *slider_red;
     lv_obj_t *slider_green;
@@ -118,23 +162,53 @@ static void update_order_index_label(void)
     }
 }
 
+/**
+ * @brief Scene index a pooled card is bound to, -1 if unbound
+ */
+static int card_get_index(lv_obj_t *card)
+{
+    return (int)(intptr_t)lv_obj_get_user_data(card);
+}
+
+/**
+ * @brief Find the pooled card bound to a scene index, NULL if not bound
+ */
+static lv_obj_t *carousel_find_card(int index)
+{
+    for (int i = 0; i < CARD_POOL_SIZE; i++) {
+        if (s_card_pool[i] && card_get_index(s_card_pool[i]) == index) {
+            return s_card_pool[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Set a card's border to the selected or unselected style
+ */
+static void card_set_selected(lv_obj_t *card, bool selected)
+{
+    // Selected: Material Blue border, thicker; unselected: light gray border
+    if (selected) {
+        lv_obj_add_style(card, ui_style(UI_STYLE_CARD_SELECTED), LV_PART_MAIN);
+    } else {
+        lv_obj_remove_style(card, ui_style(UI_STYLE_CARD_SELECTED), LV_PART_MAIN);
+    }
+}
+
 /**
  * @brief Update card selection visual - highlight selected card with blue border
  * Note: Cards have no shadows for scroll performance optimization
+ *
+ * @param selected_index Scene index; only cards currently bound are styled,
+ *                       the others get their style when they are bound
  */
 static void update_card_selection(int selected_index)
 {
-    for (size_t i = 0; i < s_cached_scene_count; i++) {
-        if (s_scene_cards[i]) {
-            if ((int)i == selected_index) {
-                // Selected: Material Blue border, thicker
-                lv_obj_set_style_border_color(s_scene_cards[i], lv_color_make(33, 150, 243), LV_PART_MAIN);
-                lv_obj_set_style_border_width(s_scene_cards[i], 4, LV_PART_MAIN);
-            } else {
-                // Unselected: light gray border
-                lv_obj_set_style_border_color(s_scene_cards[i], lv_color_make(224, 224, 224), LV_PART_MAIN);
-                lv_obj_set_style_border_width(s_scene_cards[i], 2, LV_PART_MAIN);
-            }
+    for (int i = 0; i < CARD_POOL_SIZE; i++) {
+        int index = s_card_pool[i] ? card_get_index(s_card_pool[i]) : -1;
+        if (index >= 0) {
+            card_set_selected(s_card_pool[i], index == selected_index);
         }
     }
 }
@@ -165,44 +239,38 @@ static void duration_slider_event_cb(lv_event_t *e)
 }
 
 /**
- * @brief Progress bar update timer callback (FR-043)
- * 
- * Called periodically to update the progress bar during fades.
- * Also handles pending progress start requests from external tasks.
+ * @brief Set the progress bar, skipping unchanged values so it is not invalidated
  */
-static void progress_timer_cb(lv_timer_t *timer)
+static void progress_bar_set(int32_t percent)
 {
-    // Check for pending progress start request from external task
-    if (s_scenes_state.pending_progress_start) {
-        s_scenes_state.pending_progress_start = false;
-        s_scenes_state.transition_in_progress = true;
-        s_scenes_state.fade_started = false;
-        if (s_progress_bar) {
-            lv_obj_clear_flag(s_progress_bar, LV_OBJ_FLAG_HIDDEN);
-            lv_bar_set_value(s_progress_bar, 0, LV_ANIM_OFF);
-        }
-        ESP_LOGD(TAG, "Progress tracking started from pending request");
+    if (s_progress_bar && lv_bar_get_value(s_progress_bar) != percent) {
+        lv_bar_set_value(s_progress_bar, percent, LV_ANIM_OFF);
     }
+}
+
+/**
+ * @brief Apply the latest fade progress to the progress bar (FR-043, LVGL context)
+ * 
+ * Queued by ui_scenes_notify_fade_progress() at most once at a time, so a
+ * burst of updates collapses into one redraw of the newest value.
+ */
+static void fade_progress_async_cb(void *arg)
+{
+    atomic_store(&s_fade_progress_queued, false);
+    unsigned update = atomic_load(&s_fade_progress);
     
-    // If we're not tracking a transition, nothing to do
     if (!s_scenes_state.transition_in_progress) {
         return;
     }
     
-    fade_progress_t progress;
-    fade_state_t state = fade_controller_get_progress(&progress);
-    
-    if (state == FADE_STATE_FADING) {
-        // Mark that we've seen the fade actually start
+    if (!(update & FADE_PROGRESS_DONE)) {
+        // Mark that progress of this fade has arrived
         s_scenes_state.fade_started = true;
-        // Update progress bar value (0-100)
-        if (s_progress_bar) {
-            lv_bar_set_value(s_progress_bar, progress.progress_percent, LV_ANIM_OFF);
-        }
+        progress_bar_set(update & 0xFF);
     } else if (s_scenes_state.fade_started) {
-        // Only hide if we previously saw FADING state (now IDLE or COMPLETE)
+        // Only hide once this fade has reported progress (not the end of an earlier one)
         if (s_progress_bar) {
-            lv_bar_set_value(s_progress_bar, 100, LV_ANIM_OFF);
+            progress_bar_set(100);
             lv_obj_add_flag(s_progress_bar, LV_OBJ_FLAG_HIDDEN);
         }
         s_scenes_state.transition_in_progress = false;
@@ -212,31 +280,40 @@ static void progress_timer_cb(lv_timer_t *timer)
     }
 }
 
+void ui_scenes_notify_fade_progress(uint8_t percent, bool done)
+{
+    atomic_store(&s_fade_progress, percent | (done ? FADE_PROGRESS_DONE : 0));
+    if (!atomic_exchange(&s_fade_progress_queued, true)) {
+        if (!ui_async_call(fade_progress_async_cb, NULL)) {
+            atomic_store(&s_fade_progress_queued, false);
+        }
+    }
+}
+
 /**
- * @brief Start progress bar updates (called from within LVGL context)
+ * @brief Start progress bar updates (LVGL context or ui_lock() held)
  */
 static void start_progress_updates(void)
 {
     // Show the progress bar and reset value
     if (s_progress_bar) {
         lv_obj_clear_flag(s_progress_bar, LV_OBJ_FLAG_HIDDEN);
-        lv_bar_set_value(s_progress_bar, 0, LV_ANIM_OFF);
+        progress_bar_set(0);
     }
     s_scenes_state.transition_in_progress = true;
-    s_scenes_state.fade_started = false;  // Will be set true when we see FADING
+    s_scenes_state.fade_started = false;  // Set when the fade controller reports progress
 }
 
 /**
  * @brief Start the progress bar tracking for a fade in progress (public API)
  * 
- * This is called from main.c (outside LVGL task context), so we just set
- * a pending flag that the progress timer will pick up on its next tick.
+ * Called from main.c with ui_lock() held. Progress arrives through
+ * ui_scenes_notify_fade_progress().
  */
 void ui_scenes_start_progress_tracking(void)
 {
-    // Set pending flag - the persistent timer will pick this up
-    s_scenes_state.pending_progress_start = true;
-    ESP_LOGD(TAG, "Progress tracking requested (pending)");
+    start_progress_updates();
+    ESP_LOGD(TAG, "Progress tracking started");
 }
 
 /**
@@ -280,6 +357,19 @@ static void apply_btn_event_cb(lv_event_t *e)
     }
 }
 
+/**
+ * @brief Index of a cached scene by name, -1 if not found
+ */
+static int find_cached_scene(const char *name)
+{
+    for (size_t i = 0; i < s_cached_scene_count; i++) {
+        if (strcmp(s_cached_scenes[i].name, name) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
 /**
  * @brief Close delete confirmation modal
  */
@@ -303,8 +393,13 @@ static void delete_confirm_btn_cb(lv_event_t *e)
     esp_err_t ret = scene_storage_delete(s_scenes_state.pending_delete_name);
     if (ret == ESP_OK) {
         ESP_LOGD(TAG, "Scene deleted successfully");
-        // Refresh the carousel - already in LVGL context, use no-lock version
-        scene_storage_reload_ui_no_lock();
+        // Remove just that card - already in LVGL context
+        int index = find_cached_scene(s_scenes_state.pending_delete_name);
+        if (index >= 0) {
+            ui_scenes_remove_scene(index);
+        } else {
+            scene_storage_reload_ui_no_lock();
+        }
     } else {
         ESP_LOGE(TAG, "Failed to delete scene: %s", esp_err_to_name(ret));
     }
@@ -333,26 +428,19 @@ static void show_delete_modal(const char *scene_name)
     s_delete_modal = lv_obj_create(lv_scr_act());
     lv_obj_set_size(s_delete_modal, 800, 480);
     lv_obj_center(s_delete_modal);
-    lv_obj_set_style_bg_color(s_delete_modal, lv_color_make(0, 0, 0), LV_PART_MAIN);
-    lv_obj_set_style_bg_opa(s_delete_modal, LV_OPA_50, LV_PART_MAIN);
-    lv_obj_set_style_border_width(s_delete_modal, 0, LV_PART_MAIN);
-    lv_obj_set_style_radius(s_delete_modal, 0, LV_PART_MAIN);
+    lv_obj_add_style(s_delete_modal, ui_style(UI_STYLE_MODAL_OVERLAY), LV_PART_MAIN);
     
     // Create dialog box
     lv_obj_t *dialog = lv_obj_create(s_delete_modal);
     lv_obj_set_size(dialog, 450, 250);
     lv_obj_center(dialog);
-    lv_obj_set_style_bg_color(dialog, lv_color_make(255, 255, 255), LV_PART_MAIN);
-    lv_obj_set_style_radius(dialog, 12, LV_PART_MAIN);
-    lv_obj_set_style_shadow_width(dialog, 20, LV_PART_MAIN);
-    lv_obj_set_style_shadow_opa(dialog, LV_OPA_30, LV_PART_MAIN);
-    lv_obj_set_style_pad_all(dialog, 20, LV_PART_MAIN);
+    lv_obj_add_style(dialog, ui_style(UI_STYLE_MODAL_DIALOG), LV_PART_MAIN);
     
     // Warning icon and title
     lv_obj_t *title = lv_label_create(dialog);
     lv_label_set_text(title, LV_SYMBOL_WARNING " Delete Scene?");
-    lv_obj_set_style_text_font(title, &lv_font_montserrat_32, LV_PART_MAIN);
-    lv_obj_set_style_text_color(title, lv_color_make(244, 67, 54), LV_PART_MAIN);  // Material Red
+    lv_obj_add_style(title, ui_style(UI_STYLE_FONT_32), LV_PART_MAIN);
+    lv_obj_add_style(title, ui_style(UI_STYLE_TEXT_DANGER), LV_PART_MAIN);
     lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 0);
     
     // Scene name
@@ -360,24 +448,22 @@ static void show_delete_modal(const char *scene_name)
     char buf[64];
     snprintf(buf, sizeof(buf), "\"%s\"", scene_name);
     lv_label_set_text(name_label, buf);
-    lv_obj_set_style_text_font(name_label, &lv_font_montserrat_24, LV_PART_MAIN);
-    lv_obj_set_style_text_color(name_label, lv_color_make(33, 33, 33), LV_PART_MAIN);
+    lv_obj_add_style(name_label, ui_style(UI_STYLE_FONT_24), LV_PART_MAIN);
+    lv_obj_add_style(name_label, ui_style(UI_STYLE_TEXT), LV_PART_MAIN);
     lv_obj_align(name_label, LV_ALIGN_TOP_MID, 0, 50);
     
     // Warning message
     lv_obj_t *msg_label = lv_label_create(dialog);
     lv_label_set_text(msg_label, "This action cannot be undone.");
-    lv_obj_set_style_text_font(msg_label, &lv_font_montserrat_18, LV_PART_MAIN);
-    lv_obj_set_style_text_color(msg_label, lv_color_make(117, 117, 117), LV_PART_MAIN);
+    lv_obj_add_style(msg_label, ui_style(UI_STYLE_FONT_18), LV_PART_MAIN);
+    lv_obj_add_style(msg_label, ui_style(UI_STYLE_TEXT_MUTED), LV_PART_MAIN);
     lv_obj_align(msg_label, LV_ALIGN_TOP_MID, 0, 85);
     
     // Button container
     lv_obj_t *btn_container = lv_obj_create(dialog);
     lv_obj_set_size(btn_container, 400, 70);
     lv_obj_align(btn_container, LV_ALIGN_BOTTOM_MID, 0, 0);
-    lv_obj_set_style_bg_opa(btn_container, LV_OPA_TRANSP, LV_PART_MAIN);
-    lv_obj_set_style_border_width(btn_container, 0, LV_PART_MAIN);
-    lv_obj_set_style_pad_all(btn_container, 0, LV_PART_MAIN);
+    lv_obj_add_style(btn_container, ui_style(UI_STYLE_CONTAINER), LV_PART_MAIN);
     lv_obj_set_flex_flow(btn_container, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(btn_container, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
@@ -385,26 +471,20 @@ static void show_delete_modal(const char *scene_name)
     lv_obj_t *btn_cancel = lv_btn_create(btn_container);
     lv_obj_set_size(btn_cancel, 160, 55);
     lv_obj_add_event_cb(btn_cancel, delete_cancel_btn_cb, LV_EVENT_CLICKED, NULL);
-    lv_obj_set_style_bg_color(btn_cancel, lv_color_make(158, 158, 158), LV_PART_MAIN);
-    lv_obj_set_style_radius(btn_cancel, 8, LV_PART_MAIN);
+    ui_theme_style_btn(btn_cancel, UI_STYLE_BTN_GRAY, UI_STYLE_FONT_24);
     
     lv_obj_t *cancel_label = lv_label_create(btn_cancel);
     lv_label_set_text(cancel_label, LV_SYMBOL_CLOSE " Cancel");
-    lv_obj_set_style_text_font(cancel_label, &lv_font_montserrat_24, LV_PART_MAIN);
-    lv_obj_set_style_text_color(cancel_label, lv_color_make(255, 255, 255), LV_PART_MAIN);
     lv_obj_center(cancel_label);
     
     // Delete button
     lv_obj_t *btn_delete = lv_btn_create(btn_container);
     lv_obj_set_size(btn_delete, 160, 55);
     lv_obj_add_event_cb(btn_delete, delete_confirm_btn_cb, LV_EVENT_CLICKED, NULL);
-    lv_obj_set_style_bg_color(btn_delete, lv_color_make(244, 67, 54), LV_PART_MAIN);  // Material Red
-    lv_obj_set_style_radius(btn_delete, 8, LV_PART_MAIN);
+    ui_theme_style_btn(btn_delete, UI_STYLE_BTN_RED, UI_STYLE_FONT_24);
     
     lv_obj_t *delete_label = lv_label_create(btn_delete);
     lv_label_set_text(delete_label, LV_SYMBOL_TRASH " Delete");
-    lv_obj_set_style_text_font(delete_label, &lv_font_montserrat_24, LV_PART_MAIN);
-    lv_obj_set_style_text_color(delete_label, lv_color_make(255, 255, 255), LV_PART_MAIN);
     lv_obj_center(delete_label);
 }
 
@@ -418,6 +498,7 @@ static void show_delete_modal(const char *scene_name)
 static void close_edit_modal(void)
 {
     if (s_edit_state.modal) {
+        ui_keyboard_release_no_lock(s_edit_state.name_textarea);
         lv_obj_del(s_edit_state.modal);
         memset(&s_edit_state, 0, sizeof(s_edit_state));
     }
@@ -529,9 +610,14 @@ static void edit_save_btn_cb(lv_event_t *e)
     
     if (ret == ESP_OK) {
         ESP_LOGD(TAG, "Scene updated successfully");
+        // close_edit_modal() clears s_edit_state
+        int index = s_edit_state.scene_index;
         close_edit_modal();
-        // Refresh UI - already in LVGL context, use no-lock version
-        scene_storage_reload_ui_no_lock();
+        // Refresh just that card - already in LVGL context
+        ui_scene_t scene;
+        if (scene_storage_get_by_index(index, &scene) == ESP_OK) {
+            ui_scenes_update_scene(index, &scene);
+        }
     } else if (ret == ESP_ERR_INVALID_STATE) {
         ESP_LOGW(TAG, "Scene name already exists");
         // Could show error message, but for now just log
@@ -554,6 +640,8 @@ static void edit_move_left_btn_cb(lv_event_t *e)
     
     esp_err_t ret = scene_storage_reorder(s_edit_state.scene_index, new_index);
     if (ret == ESP_OK) {
+        // Move just that card - already in LVGL context
+        ui_scenes_move_scene(s_edit_state.scene_index, new_index);
         s_edit_state.scene_index = new_index;
         // Update move button states
         if (s_edit_state.btn_move_left) {
@@ -566,8 +654,6 @@ static void edit_move_left_btn_cb(lv_event_t *e)
         }
         // Update order index label
         update_order_index_label();
-        // Refresh UI - already in LVGL context, use no-lock version
-        scene_storage_reload_ui_no_lock();
     }
 }
 
@@ -585,6 +671,8 @@ static void edit_move_right_btn_cb(lv_event_t *e)
     
     esp_err_t ret = scene_storage_reorder(s_edit_state.scene_index, new_index);
     if (ret == ESP_OK) {
+        // Move just that card - already in LVGL context
+        ui_scenes_move_scene(s_edit_state.scene_index, new_index);
         s_edit_state.scene_index = new_index;
         // Update move button states
         if (s_edit_state.btn_move_right) {
@@ -597,8 +685,6 @@ static void edit_move_right_btn_cb(lv_event_t *e)
         }
         // Update order index label
         update_order_index_label();
-        // Refresh UI - already in LVGL context, use no-lock version
-        scene_storage_reload_ui_no_lock();
     }
 }
 
@@ -611,19 +697,12 @@ static void edit_textarea_event_cb(lv_event_t *e)
     lv_obj_t *ta = lv_event_get_target(e);
     
     if (code == LV_EVENT_FOCUSED) {
-        if (s_edit_state.keyboard) {
-            lv_keyboard_set_textarea(s_edit_state.keyboard, ta);
-            lv_obj_clear_flag(s_edit_state.keyboard, LV_OBJ_FLAG_HIDDEN);
-        }
+        ui_keyboard_show_no_lock(ta, EDIT_KEYBOARD_HEIGHT);
     } else if (code == LV_EVENT_DEFOCUSED) {
-        if (s_edit_state.keyboard) {
-            lv_obj_add_flag(s_edit_state.keyboard, LV_OBJ_FLAG_HIDDEN);
-        }
+        ui_keyboard_hide_no_lock();
     } else if (code == LV_EVENT_READY) {
         // Enter pressed on keyboard - hide keyboard
-        if (s_edit_state.keyboard) {
-            lv_obj_add_flag(s_edit_state.keyboard, LV_OBJ_FLAG_HIDDEN);
-        }
+        ui_keyboard_hide_no_lock();
     }
 }
 
@@ -638,8 +717,8 @@ static void create_edit_slider(lv_obj_t *parent, const char *name, uint8_t initi
     char buf[24];
     snprintf(buf, sizeof(buf), "%s: %d", name, initial_value);
     lv_label_set_text(*out_label, buf);
-    lv_obj_set_style_text_font(*out_label, &lv_font_montserrat_16, LV_PART_MAIN);
-    lv_obj_set_style_text_color(*out_label, lv_color_make(33, 33, 33), LV_PART_MAIN);
+    lv_obj_add_style(*out_label, ui_style(UI_STYLE_FONT_16), LV_PART_MAIN);
+    lv_obj_add_style(*out_label, ui_style(UI_STYLE_TEXT), LV_PART_MAIN);
     lv_obj_align(*out_label, LV_ALIGN_TOP_LEFT, 10, y_pos);
     
     // Slider
@@ -651,9 +730,9 @@ static void create_edit_slider(lv_obj_t *parent, const char *name, uint8_t initi
     lv_obj_add_event_cb(*out_slider, edit_slider_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
     
     // Style slider
-    lv_obj_set_style_bg_color(*out_slider, lv_color_make(189, 189, 189), LV_PART_MAIN);
-    lv_obj_set_style_bg_color(*out_slider, lv_color_make(33, 150, 243), LV_PART_INDICATOR);
-    lv_obj_set_style_bg_color(*out_slider, lv_color_make(33, 150, 243), LV_PART_KNOB);
+    lv_obj_add_style(*out_slider, ui_style(UI_STYLE_SLIDER_TRACK), LV_PART_MAIN);
+    lv_obj_add_style(*out_slider, ui_style(UI_STYLE_SLIDER_ACCENT), LV_PART_INDICATOR);
+    lv_obj_add_style(*out_slider, ui_style(UI_STYLE_SLIDER_ACCENT), LV_PART_KNOB);
 }
 
 /**
@@ -676,40 +755,35 @@ static void show_edit_scene_modal(int scene_index)
     s_edit_state.white = scene->white;
     
     ESP_LOGI(TAG, "Opening edit modal for scene '%s' at index %d", scene->name, scene_index);
+    int64_t start_us = esp_timer_get_time();
     
     // Create modal background (semi-transparent overlay)
     s_edit_state.modal = lv_obj_create(lv_scr_act());
     lv_obj_set_size(s_edit_state.modal, 800, 480);
     lv_obj_center(s_edit_state.modal);
-    lv_obj_set_style_bg_color(s_edit_state.modal, lv_color_make(0, 0, 0), LV_PART_MAIN);
-    lv_obj_set_style_bg_opa(s_edit_state.modal, LV_OPA_50, LV_PART_MAIN);
-    lv_obj_set_style_border_width(s_edit_state.modal, 0, LV_PART_MAIN);
-    lv_obj_set_style_radius(s_edit_state.modal, 0, LV_PART_MAIN);
+    lv_obj_add_style(s_edit_state.modal, ui_style(UI_STYLE_MODAL_OVERLAY), LV_PART_MAIN);
     
     // Create dialog box
     lv_obj_t *dialog = lv_obj_create(s_edit_state.modal);
     lv_obj_set_size(dialog, 750, 435);
     lv_obj_align(dialog, LV_ALIGN_TOP_MID, 0, 5);
-    lv_obj_set_style_bg_color(dialog, lv_color_make(255, 255, 255), LV_PART_MAIN);
-    lv_obj_set_style_radius(dialog, 12, LV_PART_MAIN);
-    lv_obj_set_style_shadow_width(dialog, 20, LV_PART_MAIN);
-    lv_obj_set_style_shadow_opa(dialog, LV_OPA_30, LV_PART_MAIN);
-    lv_obj_set_style_pad_all(dialog, 15, LV_PART_MAIN);
+    lv_obj_add_style(dialog, ui_style(UI_STYLE_MODAL_DIALOG), LV_PART_MAIN);
+    lv_obj_add_style(dialog, ui_style(UI_STYLE_MODAL_COMPACT), LV_PART_MAIN);
     lv_obj_clear_flag(dialog, LV_OBJ_FLAG_SCROLLABLE);
     
     // Title
     lv_obj_t *title = lv_label_create(dialog);
     lv_label_set_text(title, LV_SYMBOL_EDIT " Edit Scene");
-    lv_obj_set_style_text_font(title, &lv_font_montserrat_28, LV_PART_MAIN);
-    lv_obj_set_style_text_color(title, lv_color_make(33, 33, 33), LV_PART_MAIN);
+    lv_obj_add_style(title, ui_style(UI_STYLE_FONT_28), LV_PART_MAIN);
+    lv_obj_add_style(title, ui_style(UI_STYLE_TEXT), LV_PART_MAIN);
     lv_obj_align(title, LV_ALIGN_TOP_LEFT, 0, 0);
     
     // Scene order section (top right)
     // "Scene order" label
     lv_obj_t *order_title = lv_label_create(dialog);
     lv_label_set_text(order_title, "Scene order");
-    lv_obj_set_style_text_font(order_title, &lv_font_montserrat_14, LV_PART_MAIN);
-    lv_obj_set_style_text_color(order_title, lv_color_make(97, 97, 97), LV_PART_MAIN);
+    lv_obj_add_style(order_title, ui_style(UI_STYLE_FONT_14), LV_PART_MAIN);
+    lv_obj_add_style(order_title, ui_style(UI_STYLE_TEXT_SECONDARY), LV_PART_MAIN);
     lv_obj_align(order_title, LV_ALIGN_TOP_RIGHT, -58, 10);
     
     // Move left button
@@ -717,22 +791,20 @@ static void show_edit_scene_modal(int scene_index)
     lv_obj_set_size(s_edit_state.btn_move_left, 50, 40);
     lv_obj_align(s_edit_state.btn_move_left, LV_ALIGN_TOP_RIGHT, -150, 30);
     lv_obj_add_event_cb(s_edit_state.btn_move_left, edit_move_left_btn_cb, LV_EVENT_CLICKED, NULL);
-    lv_obj_set_style_bg_color(s_edit_state.btn_move_left, lv_color_make(33, 150, 243), LV_PART_MAIN);
-    lv_obj_set_style_radius(s_edit_state.btn_move_left, 6, LV_PART_MAIN);
+    ui_theme_style_btn(s_edit_state.btn_move_left, UI_STYLE_BTN_BLUE, UI_STYLE_FONT_20);
+    lv_obj_add_style(s_edit_state.btn_move_left, ui_style(UI_STYLE_RADIUS_SMALL), LV_PART_MAIN);
     if (scene_index == 0) {
         lv_obj_add_state(s_edit_state.btn_move_left, LV_STATE_DISABLED);
     }
     
     lv_obj_t *left_label = lv_label_create(s_edit_state.btn_move_left);
     lv_label_set_text(left_label, LV_SYMBOL_LEFT);
-    lv_obj_set_style_text_font(left_label, &lv_font_montserrat_20, LV_PART_MAIN);
-    lv_obj_set_style_text_color(left_label, lv_color_make(255, 255, 255), LV_PART_MAIN);
     lv_obj_center(left_label);
     
     // Order index label (between buttons)
     s_edit_state.label_order_index = lv_label_create(dialog);
-    lv_obj_set_style_text_font(s_edit_state.label_order_index, &lv_font_montserrat_20, LV_PART_MAIN);
-    lv_obj_set_style_text_color(s_edit_state.label_order_index, lv_color_make(33, 33, 33), LV_PART_MAIN);
+    lv_obj_add_style(s_edit_state.label_order_index, ui_style(UI_STYLE_FONT_20), LV_PART_MAIN);
+    lv_obj_add_style(s_edit_state.label_order_index, ui_style(UI_STYLE_TEXT), LV_PART_MAIN);
     lv_obj_align(s_edit_state.label_order_index, LV_ALIGN_TOP_RIGHT, -80, 38);
     update_order_index_label();  // Set initial value
     
@@ -741,23 +813,21 @@ static void show_edit_scene_modal(int scene_index)
     lv_obj_set_size(s_edit_state.btn_move_right, 50, 40);
     lv_obj_align(s_edit_state.btn_move_right, LV_ALIGN_TOP_RIGHT, 0, 30);
     lv_obj_add_event_cb(s_edit_state.btn_move_right, edit_move_right_btn_cb, LV_EVENT_CLICKED, NULL);
-    lv_obj_set_style_bg_color(s_edit_state.btn_move_right, lv_color_make(33, 150, 243), LV_PART_MAIN);
-    lv_obj_set_style_radius(s_edit_state.btn_move_right, 6, LV_PART_MAIN);
+    ui_theme_style_btn(s_edit_state.btn_move_right, UI_STYLE_BTN_BLUE, UI_STYLE_FONT_20);
+    lv_obj_add_style(s_edit_state.btn_move_right, ui_style(UI_STYLE_RADIUS_SMALL), LV_PART_MAIN);
     if (scene_index >= (int)s_cached_scene_count - 1) {
         lv_obj_add_state(s_edit_state.btn_move_right, LV_STATE_DISABLED);
     }
     
     lv_obj_t *right_label = lv_label_create(s_edit_state.btn_move_right);
     lv_label_set_text(right_label, LV_SYMBOL_RIGHT);
-    lv_obj_set_style_text_font(right_label, &lv_font_montserrat_20, LV_PART_MAIN);
-    lv_obj_set_style_text_color(right_label, lv_color_make(255, 255, 255), LV_PART_MAIN);
     lv_obj_center(right_label);
     
     // Name input row
     lv_obj_t *name_label = lv_label_create(dialog);
     lv_label_set_text(name_label, "Name:");
-    lv_obj_set_style_text_font(name_label, &lv_font_montserrat_18, LV_PART_MAIN);
-    lv_obj_set_style_text_color(name_label, lv_color_make(97, 97, 97), LV_PART_MAIN);
+    lv_obj_add_style(name_label, ui_style(UI_STYLE_FONT_18), LV_PART_MAIN);
+    lv_obj_add_style(name_label, ui_style(UI_STYLE_TEXT_SECONDARY), LV_PART_MAIN);
     lv_obj_align(name_label, LV_ALIGN_TOP_LEFT, 10, 55);
     
     s_edit_state.name_textarea = lv_textarea_create(dialog);
@@ -765,17 +835,16 @@ static void show_edit_scene_modal(int scene_index)
     lv_textarea_set_text(s_edit_state.name_textarea, scene->name);
     lv_obj_set_size(s_edit_state.name_textarea, 280, 40);
     lv_obj_align(s_edit_state.name_textarea, LV_ALIGN_TOP_LEFT, 80, 45);
-    lv_obj_set_style_text_font(s_edit_state.name_textarea, &lv_font_montserrat_20, LV_PART_MAIN);
-    lv_obj_set_style_border_color(s_edit_state.name_textarea, lv_color_make(189, 189, 189), LV_PART_MAIN);
-    lv_obj_set_style_border_width(s_edit_state.name_textarea, 2, LV_PART_MAIN);
-    lv_obj_set_style_radius(s_edit_state.name_textarea, 6, LV_PART_MAIN);
+    lv_obj_add_style(s_edit_state.name_textarea, ui_style(UI_STYLE_FONT_20), LV_PART_MAIN);
+    lv_obj_add_style(s_edit_state.name_textarea, ui_style(UI_STYLE_TEXTAREA), LV_PART_MAIN);
+    lv_obj_add_style(s_edit_state.name_textarea, ui_style(UI_STYLE_RADIUS_SMALL), LV_PART_MAIN);
     lv_obj_add_event_cb(s_edit_state.name_textarea, edit_textarea_event_cb, LV_EVENT_ALL, NULL);
     
     // Color preview circle (right side)
     s_edit_state.color_preview = lv_obj_create(dialog);
     lv_obj_set_size(s_edit_state.color_preview, 150, 150);
     lv_obj_align(s_edit_state.color_preview, LV_ALIGN_TOP_RIGHT, -30, 100);
-    lv_obj_set_style_radius(s_edit_state.color_preview, LV_RADIUS_CIRCLE, LV_PART_MAIN);
+    lv_obj_add_style(s_edit_state.color_preview, ui_style(UI_STYLE_CIRCLE), LV_PART_MAIN);
     lv_obj_clear_flag(s_edit_state.color_preview, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
     update_edit_color_preview();
     
@@ -784,22 +853,17 @@ static void show_edit_scene_modal(int scene_index)
     lv_obj_set_size(btn_preview, 150, 45);
     lv_obj_align(btn_preview, LV_ALIGN_TOP_RIGHT, -30, 260);
     lv_obj_add_event_cb(btn_preview, edit_preview_btn_cb, LV_EVENT_CLICKED, NULL);
-    lv_obj_set_style_bg_color(btn_preview, lv_color_make(255, 152, 0), LV_PART_MAIN);  // Material Orange
-    lv_obj_set_style_radius(btn_preview, 8, LV_PART_MAIN);
+    ui_theme_style_btn(btn_preview, UI_STYLE_BTN_ORANGE, UI_STYLE_FONT_18);
     
     lv_obj_t *preview_label = lv_label_create(btn_preview);
     lv_label_set_text(preview_label, LV_SYMBOL_PLAY " Preview");
-    lv_obj_set_style_text_font(preview_label, &lv_font_montserrat_18, LV_PART_MAIN);
-    lv_obj_set_style_text_color(preview_label, lv_color_make(255, 255, 255), LV_PART_MAIN);
     lv_obj_center(preview_label);
     
     // Sliders container (left side)
     lv_obj_t *sliders_container = lv_obj_create(dialog);
     lv_obj_set_size(sliders_container, 480, 350);
     lv_obj_align(sliders_container, LV_ALIGN_TOP_LEFT, 0, 100);
-    lv_obj_set_style_bg_opa(sliders_container, LV_OPA_TRANSP, LV_PART_MAIN);
-    lv_obj_set_style_border_width(sliders_container, 0, LV_PART_MAIN);
-    lv_obj_set_style_pad_all(sliders_container, 0, LV_PART_MAIN);
+    lv_obj_add_style(sliders_container, ui_style(UI_STYLE_CONTAINER), LV_PART_MAIN);
     lv_obj_clear_flag(sliders_container, LV_OBJ_FLAG_SCROLLABLE);
     
     // Create sliders
@@ -818,9 +882,7 @@ static void show_edit_scene_modal(int scene_index)
     lv_obj_t *btn_container = lv_obj_create(dialog);
     lv_obj_set_size(btn_container, 650, 60);
     lv_obj_align(btn_container, LV_ALIGN_BOTTOM_MID, 0, 0);
-    lv_obj_set_style_bg_opa(btn_container, LV_OPA_TRANSP, LV_PART_MAIN);
-    lv_obj_set_style_border_width(btn_container, 0, LV_PART_MAIN);
-    lv_obj_set_style_pad_all(btn_container, 0, LV_PART_MAIN);
+    lv_obj_add_style(btn_container, ui_style(UI_STYLE_CONTAINER), LV_PART_MAIN);
     lv_obj_set_flex_flow(btn_container, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(btn_container, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     
@@ -828,72 +890,271 @@ static void show_edit_scene_modal(int scene_index)
     lv_obj_t *btn_cancel = lv_btn_create(btn_container);
     lv_obj_set_size(btn_cancel, 200, 50);
     lv_obj_add_event_cb(btn_cancel, edit_cancel_btn_cb, LV_EVENT_CLICKED, NULL);
-    lv_obj_set_style_bg_color(btn_cancel, lv_color_make(158, 158, 158), LV_PART_MAIN);
-    lv_obj_set_style_radius(btn_cancel, 8, LV_PART_MAIN);
+    ui_theme_style_btn(btn_cancel, UI_STYLE_BTN_GRAY, UI_STYLE_FONT_20);
     
     lv_obj_t *cancel_label = lv_label_create(btn_cancel);
     lv_label_set_text(cancel_label, LV_SYMBOL_CLOSE " Cancel");
-    lv_obj_set_style_text_font(cancel_label, &lv_font_montserrat_20, LV_PART_MAIN);
-    lv_obj_set_style_text_color(cancel_label, lv_color_make(255, 255, 255), LV_PART_MAIN);
     lv_obj_center(cancel_label);
     
     // Save button
     lv_obj_t *btn_save = lv_btn_create(btn_container);
     lv_obj_set_size(btn_save, 200, 50);
     lv_obj_add_event_cb(btn_save, edit_save_btn_cb, LV_EVENT_CLICKED, NULL);
-    lv_obj_set_style_bg_color(btn_save, lv_color_make(76, 175, 80), LV_PART_MAIN);
-    lv_obj_set_style_radius(btn_save, 8, LV_PART_MAIN);
+    ui_theme_style_btn(btn_save, UI_STYLE_BTN_GREEN, UI_STYLE_FONT_20);
     
     lv_obj_t *save_label = lv_label_create(btn_save);
     lv_label_set_text(save_label, LV_SYMBOL_OK " Save");
-    lv_obj_set_style_text_font(save_label, &lv_font_montserrat_20, LV_PART_MAIN);
-    lv_obj_set_style_text_color(save_label, lv_color_make(255, 255, 255), LV_PART_MAIN);
     lv_obj_center(save_label);
     
-    // Create keyboard at bottom of modal (hidden initially)
-    s_edit_state.keyboard = lv_keyboard_create(s_edit_state.modal);
-    lv_obj_set_size(s_edit_state.keyboard, 800, 200);
-    lv_obj_align(s_edit_state.keyboard, LV_ALIGN_BOTTOM_MID, 0, 0);
-    lv_keyboard_set_textarea(s_edit_state.keyboard, s_edit_state.name_textarea);
-    lv_obj_add_flag(s_edit_state.keyboard, LV_OBJ_FLAG_HIDDEN);
+    // The shared keyboard is shown when the name textarea is focused
+    ESP_LOGI(TAG, "Edit modal created in %lld us", (long long)(esp_timer_get_time() - start_us));
 }
 
 /**
- * @brief Edit button click handler on card
+ * @brief Create the off-screen widgets that card images are rendered from
+ *
+ * Same layout as a card's content area. Lives on lv_layer_sys() outside the
+ * display area, so it is never drawn to the screen.
  */
-static void card_edit_btn_cb(lv_event_t *e)
+static void card_template_create(void)
 {
-    lv_obj_t *btn = lv_event_get_target(e);
-    int scene_index = (int)(intptr_t)lv_obj_get_user_data(btn);
+    lv_obj_t *root = lv_obj_create(lv_layer_sys());
+    lv_obj_set_size(root, CARD_WIDTH - 2 * CARD_SNAPSHOT_INSET, CARD_HEIGHT - 2 * CARD_SNAPSHOT_INSET);
+    lv_obj_set_pos(root, -2 * CARD_WIDTH, 0);
+    lv_obj_set_style_bg_color(root, lv_color_make(255, 255, 255), LV_PART_MAIN);
+    lv_obj_set_style_radius(root, 0, LV_PART_MAIN);
+    lv_obj_set_style_border_width(root, 0, LV_PART_MAIN);
+    lv_obj_set_style_pad_all(root, CARD_SNAPSHOT_PAD, LV_PART_MAIN);
+    lv_obj_clear_flag(root, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+    
+    // Edit button (top-left corner)
+    lv_obj_t *btn_edit = lv_btn_create(root);
+    lv_obj_set_size(btn_edit, CARD_BTN_SIZE, CARD_BTN_SIZE);
+    lv_obj_align(btn_edit, LV_ALIGN_TOP_LEFT, -5, -5);
+    ui_theme_style_btn(btn_edit, UI_STYLE_BTN_BLUE, UI_STYLE_FONT_16);
+    lv_obj_add_style(btn_edit, ui_style(UI_STYLE_CIRCLE), LV_PART_MAIN);
     
-    if (scene_index >= 0 && scene_index < (int)s_cached_scene_count) {
-        ESP_LOGI(TAG, "Edit button pressed for scene index %d", scene_index);
-        show_edit_scene_modal(scene_index);
+    lv_obj_t *edit_icon = lv_label_create(btn_edit);
+    lv_label_set_text(edit_icon, LV_SYMBOL_EDIT);
+    lv_obj_center(edit_icon);
+    
+    // Delete button (top-right corner)
+    lv_obj_t *btn_delete = lv_btn_create(root);
+    lv_obj_set_size(btn_delete, CARD_BTN_SIZE, CARD_BTN_SIZE);
+    lv_obj_align(btn_delete, LV_ALIGN_TOP_RIGHT, 5, -5);
+    ui_theme_style_btn(btn_delete, UI_STYLE_BTN_RED, UI_STYLE_FONT_16);
+    lv_obj_add_style(btn_delete, ui_style(UI_STYLE_CIRCLE), LV_PART_MAIN);
+    
+    lv_obj_t *trash_icon = lv_label_create(btn_delete);
+    lv_label_set_text(trash_icon, LV_SYMBOL_TRASH);
+    lv_obj_center(trash_icon);
+    
+    // Color preview circle (shows approximate light color)
+    s_card_template.circle = lv_obj_create(root);
+    lv_obj_set_size(s_card_template.circle, 80, 80);
+    lv_obj_align(s_card_template.circle, LV_ALIGN_TOP_MID, 0, 40);
+    lv_obj_add_style(s_card_template.circle, ui_style(UI_STYLE_CIRCLE), LV_PART_MAIN);
+    lv_obj_clear_flag(s_card_template.circle, LV_OBJ_FLAG_SCROLLABLE);
+    
+    // Scene name (below color circle)
+    s_card_template.name = lv_label_create(root);
+    lv_obj_add_style(s_card_template.name, ui_style(UI_STYLE_FONT_24), LV_PART_MAIN);
+    lv_obj_add_style(s_card_template.name, ui_style(UI_STYLE_TEXT), LV_PART_MAIN);
+    lv_obj_set_style_text_align(s_card_template.name, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    lv_obj_set_width(s_card_template.name, CARD_WIDTH - 50);
+    lv_label_set_long_mode(s_card_template.name, LV_LABEL_LONG_WRAP);
+    lv_obj_align(s_card_template.name, LV_ALIGN_TOP_MID, 0, 140);
+    
+    // RGBW values (smaller font)
+    s_card_template.values = lv_label_create(root);
+    lv_obj_add_style(s_card_template.values, ui_style(UI_STYLE_FONT_16), LV_PART_MAIN);
+    lv_obj_add_style(s_card_template.values, ui_style(UI_STYLE_TEXT_MUTED), LV_PART_MAIN);
+    lv_obj_set_style_text_align(s_card_template.values, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    lv_obj_align(s_card_template.values, LV_ALIGN_BOTTOM_MID, 0, -5);
+    
+    lv_obj_update_layout(root);
+    s_card_template.root = root;
+    s_card_buf_size = lv_snapshot_buf_size_needed(root, LV_IMG_CF_TRUE_COLOR);
+    
+    s_card_cache = heap_caps_calloc(CONFIG_SCENE_CARD_CACHE_SIZE, sizeof(card_snapshot_t),
+                                    MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!s_card_cache) {
+        ESP_LOGE(TAG, "Failed to allocate card cache");
+        return;
+    }
+    for (int i = 0; i < CONFIG_SCENE_CARD_CACHE_SIZE; i++) {
+        s_card_cache[i].index = -1;
+    }
+    ESP_LOGI(TAG, "Card cache: %d images of %u bytes", CONFIG_SCENE_CARD_CACHE_SIZE,
+             (unsigned)s_card_buf_size);
+}
+
+/**
+ * @brief Render a scene into a cache slot
+ */
+static bool card_snapshot_render(card_snapshot_t *slot, int index, const ui_scene_t *scene)
+{
+    if (!slot->buf) {
+        slot->buf = heap_caps_malloc(s_card_buf_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!slot->buf) {
+            ESP_LOGE(TAG, "Failed to allocate card image");
+            return false;
+        }
+    }
+    
+    lv_color_t preview_color = ui_calculate_preview_color(
+        scene->brightness, scene->red, scene->green, scene->blue, scene->white);
+    lv_obj_set_style_bg_color(s_card_template.circle, preview_color, LV_PART_MAIN);
+    lv_label_set_text(s_card_template.name, scene->name);
+    lv_label_set_text_fmt(s_card_template.values, "Brightness:%d\nR:%d G:%d B:%d W:%d",
+                          scene->brightness, scene->red, scene->green, scene->blue, scene->white);
+    lv_obj_update_layout(s_card_template.root);
+    
+    // LVGL's image cache is keyed by the descriptor, which is reused
+    lv_img_cache_invalidate_src(&slot->img);
+    if (lv_snapshot_take_to_buf(s_card_template.root, LV_IMG_CF_TRUE_COLOR, &slot->img,
+                                slot->buf, s_card_buf_size) != LV_RES_OK) {
+        slot->index = -1;
+        return false;
+    }
+    slot->index = index;
+    slot->scene = *scene;
+    return true;
+}
+
+/**
+ * @brief Find the cached image of a card, NULL if it is not rendered
+ */
+static card_snapshot_t *card_cache_find(int index)
+{
+    if (!s_card_cache) {
+        return NULL;
     }
+    for (int i = 0; i < CONFIG_SCENE_CARD_CACHE_SIZE; i++) {
+        if (s_card_cache[i].index == index) {
+            return &s_card_cache[i];
+        }
+    }
+    return NULL;
 }
 
 /**
- * @brief Delete button click handler on card
+ * @brief Render one card around @p center that is missing or out of date
+ *
+ * Cards nearest @p center go first. A card is re-rendered only when its
+ * scene data differs from what its image was rendered from. Slots furthest
+ * from @p center are reused first.
+ *
+ * @return true if an image was rendered, false if none was needed
  */
-static void card_delete_btn_cb(lv_event_t *e)
+static bool card_cache_render_next(int center)
 {
-    lv_obj_t *btn = lv_event_get_target(e);
-    int scene_index = (int)(intptr_t)lv_obj_get_user_data(btn);
+    if (s_cached_scene_count == 0) {
+        return false;
+    }
+    if (!s_card_template.root) {
+        card_template_create();
+    }
+    if (!s_card_cache) {
+        return false;
+    }
     
-    if (scene_index >= 0 && scene_index < (int)s_cached_scene_count) {
-        const char *scene_name = s_cached_scenes[scene_index].name;
-        ESP_LOGI(TAG, "Delete button pressed for scene: %s (index %d)", scene_name, scene_index);
-        show_delete_modal(scene_name);
+    // Order: center, center + 1, center - 1, center + 2, ...
+    for (int step = 0; step <= 2 * CARD_CACHE_WINDOW; step++) {
+        int offset = (step + 1) / 2;
+        int index = center + (step % 2 ? offset : -offset);
+        if (index < 0 || index >= (int)s_cached_scene_count) {
+            continue;
+        }
+        const ui_scene_t *scene = &s_cached_scenes[index];
+        card_snapshot_t *slot = card_cache_find(index);
+        if (slot && memcmp(&slot->scene, scene, sizeof(ui_scene_t)) == 0) {
+            continue;
+        }
+        
+        if (!slot) {
+            // Free slot, else the one furthest from the window
+            int farthest = -1;
+            for (int i = 0; i < CONFIG_SCENE_CARD_CACHE_SIZE; i++) {
+                card_snapshot_t *candidate = &s_card_cache[i];
+                if (candidate->index < 0) {
+                    slot = candidate;
+                    break;
+                }
+                int distance = abs(candidate->index - center);
+                if (distance > CARD_CACHE_WINDOW && distance > farthest) {
+                    farthest = distance;
+                    slot = candidate;
+                }
+            }
+        }
+        
+        if (!slot || !card_snapshot_render(slot, index, scene)) {
+            continue;
+        }
+        lv_obj_t *card = carousel_find_card(index);
+        if (card) {
+            lv_obj_invalidate(card);
+        }
+        return true;
     }
+    return false;
 }
 
 /**
- * @brief Card tap handler - selects the scene
+ * @brief Draw a card's cached image over its background and border
+ */
+static void card_draw_cb(lv_event_t *e)
+{
+    lv_obj_t *card = lv_event_get_target(e);
+    const card_snapshot_t *slot = card_cache_find(card_get_index(card));
+    if (!slot) {
+        return;
+    }
+    
+    lv_area_t area;
+    area.x1 = card->coords.x1 + CARD_SNAPSHOT_INSET;
+    area.y1 = card->coords.y1 + CARD_SNAPSHOT_INSET;
+    area.x2 = area.x1 + slot->img.header.w - 1;
+    area.y2 = area.y1 + slot->img.header.h - 1;
+    
+    lv_draw_img_dsc_t img_dsc;
+    lv_draw_img_dsc_init(&img_dsc);
+    lv_draw_img(lv_event_get_draw_ctx(e), &img_dsc, &area, &slot->img);
+}
+
+/**
+ * @brief Card tap handler - edit/delete buttons, otherwise selects the scene
+ *
+ * The buttons are part of the card image, so taps are hit-tested here.
  */
 static void card_click_cb(lv_event_t *e)
 {
     lv_obj_t *card = lv_event_get_target(e);
-    int index = (int)(intptr_t)lv_obj_get_user_data(card);
+    int index = card_get_index(card);
+    
+    if (index < 0 || index >= (int)s_cached_scene_count) {
+        return;
+    }
+    
+    lv_point_t point;
+    lv_indev_get_point(lv_indev_get_act(), &point);
+    lv_coord_t x = point.x - card->coords.x1;
+    lv_coord_t y = point.y - card->coords.y1;
+    
+    if (y >= CARD_BTN_INSET && y < CARD_BTN_INSET + CARD_BTN_SIZE) {
+        if (x >= CARD_BTN_INSET && x < CARD_BTN_INSET + CARD_BTN_SIZE) {
+            ESP_LOGI(TAG, "Edit button pressed for scene index %d", index);
+            show_edit_scene_modal(index);
+            return;
+        }
+        if (x >= CARD_WIDTH - CARD_BTN_INSET - CARD_BTN_SIZE && x < CARD_WIDTH - CARD_BTN_INSET) {
+            const char *scene_name = s_cached_scenes[index].name;
+            ESP_LOGI(TAG, "Delete button pressed for scene: %s (index %d)", scene_name, index);
+            show_delete_modal(scene_name);
+            return;
+        }
+    }
     
     s_scenes_state.current_scene_index = index;
     ESP_LOGI(TAG, "Scene card selected: %d", index);
@@ -909,17 +1170,173 @@ static void card_click_cb(lv_event_t *e)
 }
 
 /**
- * @brief Carousel scroll end handler - update selected scene based on centered card
+ * @brief Index of the card nearest the carousel centre
  */
-static void carousel_scroll_end_cb(lv_event_t *e)
+static int carousel_center_index(void)
 {
-    if (!s_carousel || s_cached_scene_count == 0) return;
-    
     lv_coord_t scroll_x = lv_obj_get_scroll_x(s_carousel);
     int card_index = (scroll_x + CARD_WIDTH / 2) / (CARD_WIDTH + CARD_GAP);
     
     if (card_index < 0) card_index = 0;
     if (card_index >= (int)s_cached_scene_count) card_index = s_cached_scene_count - 1;
+    return card_index;
+}
+
+/**
+ * @brief Card render timer - one image per run, so scrolling stays smooth
+ */
+static void card_render_timer_cb(lv_timer_t *timer)
+{
+    if (!s_carousel || !card_cache_render_next(carousel_center_index())) {
+        lv_timer_pause(timer);
+    }
+}
+
+/**
+ * @brief Render the cards around the carousel centre from the render timer
+ *
+ * A card without an image shows only its background and border until the
+ * timer reaches it.
+ */
+static void card_render_schedule(void)
+{
+    if (!s_card_render_timer) {
+        s_card_render_timer = lv_timer_create(card_render_timer_cb,
+                                              CARD_RENDER_PERIOD_MS, NULL);
+    } else {
+        lv_timer_resume(s_card_render_timer);
+    }
+    lv_timer_ready(s_card_render_timer);
+}
+
+/**
+ * @brief Bind pooled cards to the scenes around @p center
+ *
+ * Cards bound outside the window are released and rebound to the scenes
+ * entering it, so only CARD_POOL_SIZE card objects exist whatever the
+ * number of scenes. Cards already bound inside the window are not touched.
+ * Images are rendered later by the card render timer.
+ */
+static void carousel_bind_window(int center)
+{
+    int first = center - CARD_CACHE_WINDOW;
+    int last = center + CARD_CACHE_WINDOW;
+    if (first < 0) first = 0;
+    if (last >= (int)s_cached_scene_count) last = s_cached_scene_count - 1;
+    
+    // Release cards that left the window
+    for (int i = 0; i < CARD_POOL_SIZE; i++) {
+        int index = card_get_index(s_card_pool[i]);
+        if (index >= 0 && (index < first || index > last)) {
+            lv_obj_set_user_data(s_card_pool[i], (void*)(intptr_t)-1);
+            lv_obj_add_flag(s_card_pool[i], LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+    
+    // Bind free cards to the scenes that entered it
+    for (int index = first; index <= last; index++) {
+        if (carousel_find_card(index)) {
+            continue;
+        }
+        lv_obj_t *card = carousel_find_card(-1);
+        if (!card) {
+            break;
+        }
+        lv_obj_set_user_data(card, (void*)(intptr_t)index);
+        lv_obj_align(card, LV_ALIGN_LEFT_MID, index * (CARD_WIDTH + CARD_GAP), 0);
+        card_set_selected(card, index == s_scenes_state.current_scene_index);
+        lv_obj_clear_flag(card, LV_OBJ_FLAG_HIDDEN);
+    }
+    
+    card_render_schedule();
+}
+
+/**
+ * @brief New index of a scene after a move (or a removal when @p to < 0)
+ *
+ * @return The new index, or -1 for the removed scene
+ */
+static int remap_index(int index, int from, int to)
+{
+    if (index < 0) {
+        return index;
+    }
+    if (index == from) {
+        return to;
+    }
+    if (to < 0) {
+        return index > from ? index - 1 : index;
+    }
+    if (from < to && index > from && index <= to) {
+        return index - 1;
+    }
+    if (from > to && index >= to && index < from) {
+        return index + 1;
+    }
+    return index;
+}
+
+/**
+ * @brief Renumber cached images, bound cards and selection after a move or removal
+ *
+ * Images and cards follow their scene, so nothing is re-rendered.
+ */
+static void carousel_remap(int from, int to)
+{
+    if (s_card_cache) {
+        for (int i = 0; i < CONFIG_SCENE_CARD_CACHE_SIZE; i++) {
+            s_card_cache[i].index = remap_index(s_card_cache[i].index, from, to);
+        }
+    }
+    
+    for (int i = 0; i < CARD_POOL_SIZE; i++) {
+        int index = card_get_index(s_card_pool[i]);
+        int new_index = remap_index(index, from, to);
+        if (new_index == index) {
+            continue;
+        }
+        lv_obj_set_user_data(s_card_pool[i], (void*)(intptr_t)new_index);
+        if (new_index < 0) {
+            lv_obj_add_flag(s_card_pool[i], LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_align(s_card_pool[i], LV_ALIGN_LEFT_MID, new_index * (CARD_WIDTH + CARD_GAP), 0);
+        }
+    }
+    
+    int selected = remap_index(s_scenes_state.current_scene_index, from, to);
+    if (selected < 0) {
+        // Selected scene removed: select the one that took its place
+        selected = from < (int)s_cached_scene_count ? from : (int)s_cached_scene_count - 1;
+    }
+    s_scenes_state.current_scene_index = selected < 0 ? 0 : selected;
+}
+
+/**
+ * @brief Place the scroll extent spacer at the right edge of the last card
+ */
+static void carousel_update_extent(void)
+{
+    size_t count = s_cached_scene_count;
+    lv_coord_t content_width = count > 0 ? count * (CARD_WIDTH + CARD_GAP) - CARD_GAP : 1;
+    lv_obj_align(s_carousel_spacer, LV_ALIGN_LEFT_MID, content_width - 1, 0);
+}
+
+/**
+ * @brief Carousel scroll handler - recycle cards for those coming into view
+ */
+static void carousel_scroll_cb(lv_event_t *e)
+{
+    carousel_bind_window(carousel_center_index());
+}
+
+/**
+ * @brief Carousel scroll end handler - update selected scene based on centered card
+ */
+static void carousel_scroll_end_cb(lv_event_t *e)
+{
+    if (!s_carousel || s_cached_scene_count == 0) return;
+    
+    int card_index = carousel_center_index();
     
     if (card_index != s_scenes_state.current_scene_index) {
         s_scenes_state.current_scene_index = card_index;
@@ -931,93 +1348,68 @@ static void carousel_scroll_end_cb(lv_event_t *e)
 }
 
 /**
- * @brief Create a scene card
+ * @brief Create an unbound (hidden) scene card for the pool
+ *
+ * The card is a single object: its background and border are styled (the
+ * border shows selection), and its content is drawn from the card cache.
  */
-static lv_obj_t* create_scene_card(lv_obj_t *parent, const ui_scene_t *scene, int index)
+static lv_obj_t* create_scene_card(lv_obj_t *parent)
 {
     // Card container (no shadows for smooth scroll performance)
     lv_obj_t *card = lv_obj_create(parent);
     lv_obj_set_size(card, CARD_WIDTH, CARD_HEIGHT);
-    lv_obj_set_style_bg_color(card, lv_color_make(255, 255, 255), LV_PART_MAIN);
-    lv_obj_set_style_radius(card, 16, LV_PART_MAIN);
-    lv_obj_set_style_border_width(card, 2, LV_PART_MAIN);
-    lv_obj_set_style_border_color(card, lv_color_make(224, 224, 224), LV_PART_MAIN);
-    lv_obj_set_style_pad_all(card, 15, LV_PART_MAIN);
+    lv_obj_add_style(card, ui_style(UI_STYLE_CARD), LV_PART_MAIN);
     lv_obj_clear_flag(card, LV_OBJ_FLAG_SCROLLABLE);
     
-    // Store scene index for selection
-    lv_obj_set_user_data(card, (void*)(intptr_t)index);
+    // Bound scene index for selection and the image lookup
+    lv_obj_set_user_data(card, (void*)(intptr_t)-1);
+    lv_obj_add_flag(card, LV_OBJ_FLAG_HIDDEN);
     lv_obj_add_event_cb(card, card_click_cb, LV_EVENT_CLICKED, NULL);
-    
-    // Edit button (top-left corner)
-    lv_obj_t *btn_edit = lv_btn_create(card);
-    lv_obj_set_size(btn_edit, 36, 36);
-    lv_obj_align(btn_edit, LV_ALIGN_TOP_LEFT, -5, -5);
-    lv_obj_set_style_bg_color(btn_edit, lv_color_make(33, 150, 243), LV_PART_MAIN);  // Material Blue
-    lv_obj_set_style_radius(btn_edit, LV_RADIUS_CIRCLE, LV_PART_MAIN);
-    
-    // Store scene index in edit button for callback
-    lv_obj_set_user_data(btn_edit, (void*)(intptr_t)index);
-    lv_obj_add_event_cb(btn_edit, card_edit_btn_cb, LV_EVENT_CLICKED, NULL);
-    
-    lv_obj_t *edit_icon = lv_label_create(btn_edit);
-    lv_label_set_text(edit_icon, LV_SYMBOL_EDIT);
-    lv_obj_set_style_text_font(edit_icon, &lv_font_montserrat_16, LV_PART_MAIN);
-    lv_obj_set_style_text_color(edit_icon, lv_color_make(255, 255, 255), LV_PART_MAIN);
-    lv_obj_center(edit_icon);
-    
-    // Delete button (top-right corner)
-    lv_obj_t *btn_delete = lv_btn_create(card);
-    lv_obj_set_size(btn_delete, 36, 36);
-    lv_obj_align(btn_delete, LV_ALIGN_TOP_RIGHT, 5, -5);
-    lv_obj_set_style_bg_color(btn_delete, lv_color_make(244, 67, 54), LV_PART_MAIN);  // Material Red
-    lv_obj_set_style_radius(btn_delete, LV_RADIUS_CIRCLE, LV_PART_MAIN);
-    
-    // Store scene index in delete button for callback (same as card)
-    lv_obj_set_user_data(btn_delete, (void*)(intptr_t)index);
-    lv_obj_add_event_cb(btn_delete, card_delete_btn_cb, LV_EVENT_CLICKED, NULL);
-    
-    lv_obj_t *trash_icon = lv_label_create(btn_delete);
-    lv_label_set_text(trash_icon, LV_SYMBOL_TRASH);
-    lv_obj_set_style_text_font(trash_icon, &lv_font_montserrat_16, LV_PART_MAIN);
-    lv_obj_set_style_text_color(trash_icon, lv_color_make(255, 255, 255), LV_PART_MAIN);
-    lv_obj_center(trash_icon);
-    
-    // Color preview circle (shows approximate light color)
-    lv_obj_t *color_circle = lv_obj_create(card);
-    lv_obj_set_size(color_circle, 80, 80);
-    lv_obj_align(color_circle, LV_ALIGN_TOP_MID, 0, 40);
-    lv_obj_set_style_radius(color_circle, LV_RADIUS_CIRCLE, LV_PART_MAIN);
-    lv_color_t preview_color = ui_calculate_preview_color(
-        scene->brightness, scene->red, scene->green, scene->blue, scene->white);
-    lv_obj_set_style_bg_color(color_circle, preview_color, LV_PART_MAIN);
-    lv_obj_clear_flag(color_circle, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
-    
-    // Scene name (below color circle)
-    lv_obj_t *name_label = lv_label_create(card);
-    lv_label_set_text(name_label, scene->name);
-    lv_obj_set_style_text_font(name_label, &lv_font_montserrat_24, LV_PART_MAIN);
-    lv_obj_set_style_text_color(name_label, lv_color_make(33, 33, 33), LV_PART_MAIN);
-    lv_obj_set_style_text_align(name_label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
-    lv_obj_set_width(name_label, CARD_WIDTH - 50);
-    lv_label_set_long_mode(name_label, LV_LABEL_LONG_WRAP);
-    lv_obj_align(name_label, LV_ALIGN_TOP_MID, 0, 140);
-    
-    // RGBW values (smaller font)
-    char values_buf[80];
-    snprintf(values_buf, sizeof(values_buf), "Brightness:%d\nR:%d G:%d B:%d W:%d",
-             scene->brightness, scene->red, scene->green, scene->blue, scene->white);
-    
-    lv_obj_t *values_label = lv_label_create(card);
-    lv_label_set_text(values_label, values_buf);
-    lv_obj_set_style_text_font(values_label, &lv_font_montserrat_16, LV_PART_MAIN);
-    lv_obj_set_style_text_color(values_label, lv_color_make(117, 117, 117), LV_PART_MAIN);
-    lv_obj_set_style_text_align(values_label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
-    lv_obj_align(values_label, LV_ALIGN_BOTTOM_MID, 0, -5);
+    lv_obj_add_event_cb(card, card_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
     
     return card;
 }
 
+/**
+ * @brief Category dropdown event handler - show the selected category
+ */
+static void category_dropdown_event_cb(lv_event_t *e)
+{
+    size_t category = lv_dropdown_get_selected(lv_event_get_target(e));
+    if (category == scene_storage_get_active_category()) {
+        return;
+    }
+
+    esp_err_t ret = scene_storage_open_category(category);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to open category %d: %s", (int)category, esp_err_to_name(ret));
+        lv_dropdown_set_selected(s_dropdown_category, scene_storage_get_active_category());
+        return;
+    }
+
+    // Already in LVGL context
+    scene_storage_reload_ui_no_lock();
+}
+
+/**
+ * @brief Refresh the category dropdown options and selection
+ */
+static void update_category_dropdown(void)
+{
+    size_t count = scene_storage_get_category_count();
+    if (count <= 1) {
+        lv_obj_add_flag(s_dropdown_category, LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
+
+    lv_dropdown_clear_options(s_dropdown_category);
+    for (size_t i = 0; i < count; i++) {
+        lv_dropdown_add_option(s_dropdown_category, scene_storage_get_category_name(i), i);
+    }
+    lv_dropdown_set_selected(s_dropdown_category, scene_storage_get_active_category());
+    lv_obj_clear_flag(s_dropdown_category, LV_OBJ_FLAG_HIDDEN);
+}
+
 /**
  * @brief Create the scene selector tab content (FR-040)
  */
@@ -1032,8 +1424,7 @@ void ui_create_scenes_tab(lv_obj_t *parent)
     s_carousel = lv_obj_create(parent);
     lv_obj_set_size(s_carousel, 760, CAROUSEL_HEIGHT);
     lv_obj_align(s_carousel, LV_ALIGN_TOP_MID, 0, 5);
-    lv_obj_set_style_bg_opa(s_carousel, LV_OPA_TRANSP, LV_PART_MAIN);
-    lv_obj_set_style_border_width(s_carousel, 0, LV_PART_MAIN);
+    lv_obj_add_style(s_carousel, ui_style(UI_STYLE_CONTAINER), LV_PART_MAIN);
     // Use left/right padding to center first/last cards and constrain scroll
     lv_obj_set_style_pad_left(s_carousel, center_pad, LV_PART_MAIN);
     lv_obj_set_style_pad_right(s_carousel, center_pad, LV_PART_MAIN);
@@ -1045,27 +1436,44 @@ void ui_create_scenes_tab(lv_obj_t *parent)
     lv_obj_set_scroll_snap_x(s_carousel, LV_SCROLL_SNAP_CENTER);
     lv_obj_set_scrollbar_mode(s_carousel, LV_SCROLLBAR_MODE_OFF);
     
-    // Flex layout for cards
-    lv_obj_set_flex_flow(s_carousel, LV_FLEX_FLOW_ROW);
-    lv_obj_set_flex_align(s_carousel, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-    lv_obj_set_style_pad_column(s_carousel, CARD_GAP, LV_PART_MAIN);
-    
     // Add scroll end event to update selected scene
     lv_obj_add_event_cb(s_carousel, carousel_scroll_end_cb, LV_EVENT_SCROLL_END, NULL);
+    lv_obj_add_event_cb(s_carousel, carousel_scroll_cb, LV_EVENT_SCROLL, NULL);
 
-    // Placeholder "No scenes" label (will be replaced when scenes are loaded)
+    // Placeholder "No scenes" label (hidden while scenes are loaded)
     s_label_no_scenes = lv_label_create(s_carousel);
     lv_label_set_text(s_label_no_scenes, "No scenes\n\nSave a scene from Manual Control");
-    lv_obj_set_style_text_font(s_label_no_scenes, &lv_font_montserrat_28, LV_PART_MAIN);
-    lv_obj_set_style_text_color(s_label_no_scenes, lv_color_make(158, 158, 158), LV_PART_MAIN);
+    lv_obj_add_style(s_label_no_scenes, ui_style(UI_STYLE_FONT_28), LV_PART_MAIN);
+    lv_obj_set_style_text_color(s_label_no_scenes, UI_COLOR_GRAY, LV_PART_MAIN);
     lv_obj_set_style_text_align(s_label_no_scenes, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    lv_obj_align(s_label_no_scenes, LV_ALIGN_LEFT_MID, 0, 0);
+
+    // Cards are placed by index rather than by a flex layout; an invisible
+    // spacer at the right edge of the last card sets the scroll extent
+    s_carousel_spacer = lv_obj_create(s_carousel);
+    lv_obj_remove_style_all(s_carousel_spacer);
+    lv_obj_set_size(s_carousel_spacer, 1, 1);
+    lv_obj_clear_flag(s_carousel_spacer, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SNAPPABLE);
+    lv_obj_align(s_carousel_spacer, LV_ALIGN_LEFT_MID, 0, 0);
+
+    for (int i = 0; i < CARD_POOL_SIZE; i++) {
+        s_card_pool[i] = create_scene_card(s_carousel);
+    }
+
+    // Category selector, over the carousel's left padding (hidden with one category)
+    s_dropdown_category = lv_dropdown_create(parent);
+    lv_obj_set_width(s_dropdown_category, 220);
+    lv_obj_align(s_dropdown_category, LV_ALIGN_TOP_LEFT, 20, 15);
+    lv_obj_add_style(s_dropdown_category, ui_style(UI_STYLE_FONT_20), LV_PART_MAIN);
+    lv_obj_add_event_cb(s_dropdown_category, category_dropdown_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    lv_obj_add_flag(s_dropdown_category, LV_OBJ_FLAG_HIDDEN);
 
     // Create transition duration slider (FR-041)
     // Position below carousel with proper spacing
     s_label_duration = lv_label_create(parent);
     update_duration_label(s_scenes_state.transition_duration_sec);
-    lv_obj_set_style_text_font(s_label_duration, &lv_font_montserrat_20, LV_PART_MAIN);
-    lv_obj_set_style_text_color(s_label_duration, lv_color_hex(0x333333), LV_PART_MAIN);
+    lv_obj_add_style(s_label_duration, ui_style(UI_STYLE_FONT_20), LV_PART_MAIN);
+    lv_obj_add_style(s_label_duration, ui_style(UI_STYLE_TEXT_DARK), LV_PART_MAIN);
     lv_obj_align(s_label_duration, LV_ALIGN_BOTTOM_LEFT, 20, -70);
     
     s_slider_duration = lv_slider_create(parent);
@@ -1076,10 +1484,9 @@ void ui_create_scenes_tab(lv_obj_t *parent)
     lv_obj_add_event_cb(s_slider_duration, duration_slider_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
     
     // Style the duration slider - Material Blue
-    lv_obj_set_style_bg_color(s_slider_duration, lv_color_make(189, 189, 189), LV_PART_MAIN);
-    lv_obj_set_style_bg_color(s_slider_duration, lv_color_make(33, 150, 243), LV_PART_INDICATOR);
-    lv_obj_set_style_bg_color(s_slider_duration, lv_color_make(33, 150, 243), LV_PART_KNOB);
-    lv_obj_set_style_border_width(s_slider_duration, 0, LV_PART_MAIN);
+    lv_obj_add_style(s_slider_duration, ui_style(UI_STYLE_SLIDER_TRACK), LV_PART_MAIN);
+    lv_obj_add_style(s_slider_duration, ui_style(UI_STYLE_SLIDER_ACCENT), LV_PART_INDICATOR);
+    lv_obj_add_style(s_slider_duration, ui_style(UI_STYLE_SLIDER_ACCENT), LV_PART_KNOB);
 
     // Create progress bar (FR-043) - positioned between carousel and apply button
     s_progress_bar = lv_bar_create(parent);
@@ -1088,11 +1495,10 @@ void ui_create_scenes_tab(lv_obj_t *parent)
     lv_bar_set_value(s_progress_bar, 0, LV_ANIM_OFF);
     
     // Style the progress bar - Material Green
-    lv_obj_set_style_bg_color(s_progress_bar, lv_color_make(189, 189, 189), LV_PART_MAIN);
-    lv_obj_set_style_bg_color(s_progress_bar, lv_color_make(76, 175, 80), LV_PART_INDICATOR);
-    lv_obj_set_style_border_width(s_progress_bar, 0, LV_PART_MAIN);
-    lv_obj_set_style_radius(s_progress_bar, 8, LV_PART_MAIN);
-    lv_obj_set_style_radius(s_progress_bar, 8, LV_PART_INDICATOR);
+    lv_obj_add_style(s_progress_bar, ui_style(UI_STYLE_SLIDER_TRACK), LV_PART_MAIN);
+    lv_obj_add_style(s_progress_bar, ui_style(UI_STYLE_BTN_GREEN), LV_PART_INDICATOR);
+    lv_obj_add_style(s_progress_bar, ui_style(UI_STYLE_BAR), LV_PART_MAIN);
+    lv_obj_add_style(s_progress_bar, ui_style(UI_STYLE_BAR), LV_PART_INDICATOR);
     
     // Initially hide progress bar
     lv_obj_add_flag(s_progress_bar, LV_OBJ_FLAG_HIDDEN);
@@ -1105,24 +1511,34 @@ void ui_create_scenes_tab(lv_obj_t *parent)
     
     lv_obj_t *label_apply = lv_label_create(s_btn_apply);
     lv_label_set_text(label_apply, LV_SYMBOL_PLAY " Apply Scene");
-    lv_obj_set_style_text_font(label_apply, &lv_font_montserrat_24, LV_PART_MAIN);
     lv_obj_center(label_apply);
     
     // Style Apply button - Material Green
-    lv_obj_set_style_bg_color(s_btn_apply, lv_color_make(76, 175, 80), LV_PART_MAIN);
-    lv_obj_set_style_bg_opa(s_btn_apply, LV_OPA_COVER, LV_PART_MAIN);
-    lv_obj_set_style_text_color(label_apply, lv_color_make(255, 255, 255), LV_PART_MAIN);
-    lv_obj_set_style_shadow_width(s_btn_apply, 4, LV_PART_MAIN);
-    lv_obj_set_style_shadow_opa(s_btn_apply, LV_OPA_30, LV_PART_MAIN);
-    lv_obj_set_style_radius(s_btn_apply, 8, LV_PART_MAIN);
-
-    // Create persistent timer for progress bar updates (runs every 100ms)
-    // This timer handles both internal and external fade tracking
-    s_progress_timer = lv_timer_create(progress_timer_cb, 100, NULL);
+    ui_theme_style_btn(s_btn_apply, UI_STYLE_BTN_GREEN, UI_STYLE_FONT_24);
+    lv_obj_add_style(s_btn_apply, ui_style(UI_STYLE_BTN_RAISED), LV_PART_MAIN);
 
     ESP_LOGI(TAG, "Scene selector tab created");
 }
 
+/**
+ * @brief Grow the scene cache to hold @p count scenes
+ */
+static bool reserve_scene_capacity(size_t count)
+{
+    if (count <= s_scene_capacity) {
+        return true;
+    }
+
+    ui_scene_t *scenes = heap_caps_realloc(s_cached_scenes, count * sizeof(ui_scene_t),
+                                           MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!scenes) {
+        return false;
+    }
+    s_cached_scenes = scenes;
+    s_scene_capacity = count;
+    return true;
+}
+
 /**
  * @brief Load scenes from SD card and populate the carousel (FR-040)
  * 
@@ -1136,39 +1552,103 @@ void ui_scenes_load_from_sd(const ui_scene_t *scenes, size_t count)
         return;
     }
 
-    // Clear card array
-    memset(s_scene_cards, 0, sizeof(s_scene_cards));
+    if (!scenes || !reserve_scene_capacity(count)) {
+        if (scenes && count > 0) {
+            ESP_LOGE(TAG, "Failed to allocate cache for %d scenes", (int)count);
+        }
+        count = 0;
+    }
 
     // Cache scenes for later access
-    s_cached_scene_count = (count > SCENE_STORAGE_MAX_SCENES) ? SCENE_STORAGE_MAX_SCENES : count;
-    if (scenes && count > 0) {
-        memcpy(s_cached_scenes, scenes, s_cached_scene_count * sizeof(ui_scene_t));
+    s_cached_scene_count = count;
+    if (count > 0) {
+        memcpy(s_cached_scenes, scenes, count * sizeof(ui_scene_t));
     }
 
-    // Clear existing carousel content
-    lv_obj_clean(s_carousel);
+    update_category_dropdown();
+
+    carousel_update_extent();
+
+    // Reset to first scene
+    s_scenes_state.current_scene_index = 0;
+    lv_obj_scroll_to_x(s_carousel, 0, LV_ANIM_OFF);
 
     if (count == 0) {
         // Show "no scenes" message
-        s_label_no_scenes = lv_label_create(s_carousel);
-        lv_label_set_text(s_label_no_scenes, "No scenes\n\nSave a scene from Manual Control");
-        lv_obj_set_style_text_font(s_label_no_scenes, &lv_font_montserrat_28, LV_PART_MAIN);
-        lv_obj_set_style_text_color(s_label_no_scenes, lv_color_make(158, 158, 158), LV_PART_MAIN);
-        lv_obj_set_style_text_align(s_label_no_scenes, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
-        s_scenes_state.current_scene_index = 0;
+        lv_obj_clear_flag(s_label_no_scenes, LV_OBJ_FLAG_HIDDEN);
     } else {
-        // Create cards for each scene and store in array
-        // (Carousel uses left/right padding to center first/last cards)
-        for (size_t i = 0; i < count; i++) {
-            s_scene_cards[i] = create_scene_card(s_carousel, &scenes[i], i);
-        }
-        
-        // Reset to first scene and update selection visual
-        s_scenes_state.current_scene_index = 0;
-        update_card_selection(0);
-        
-        ESP_LOGI(TAG, "Loaded %d scene cards", count);
+        lv_obj_add_flag(s_label_no_scenes, LV_OBJ_FLAG_HIDDEN);
+    }
+
+    // Rebind the pooled cards and update selection visual; unchanged
+    // scenes keep their images, only new or edited ones render
+    carousel_bind_window(0);
+    update_card_selection(0);
+
+    ESP_LOGI(TAG, "Carousel loaded with %d scenes", (int)count);
+}
+
+void ui_scenes_update_scene(size_t index, const ui_scene_t *scene)
+{
+    if (!s_carousel || !scene || index >= s_cached_scene_count) {
+        return;
+    }
+
+    s_cached_scenes[index] = *scene;
+
+    // Re-renders the card's image if it is in view; otherwise it is
+    // rendered when it scrolls in
+    card_render_schedule();
+}
+
+void ui_scenes_move_scene(size_t from_index, size_t to_index)
+{
+    if (!s_carousel || from_index >= s_cached_scene_count ||
+        to_index >= s_cached_scene_count || from_index == to_index) {
+        return;
     }
+
+    ui_scene_t moved = s_cached_scenes[from_index];
+    if (from_index < to_index) {
+        memmove(&s_cached_scenes[from_index], &s_cached_scenes[from_index + 1],
+                (to_index - from_index) * sizeof(ui_scene_t));
+    } else {
+        memmove(&s_cached_scenes[to_index + 1], &s_cached_scenes[to_index],
+                (from_index - to_index) * sizeof(ui_scene_t));
+    }
+    s_cached_scenes[to_index] = moved;
+
+    carousel_remap(from_index, to_index);
+    carousel_bind_window(carousel_center_index());
+    update_card_selection(s_scenes_state.current_scene_index);
+}
+
+void ui_scenes_remove_scene(size_t index)
+{
+    if (!s_carousel || index >= s_cached_scene_count) {
+        return;
+    }
+
+    memmove(&s_cached_scenes[index], &s_cached_scenes[index + 1],
+            (s_cached_scene_count - index - 1) * sizeof(ui_scene_t));
+    s_cached_scene_count--;
+
+    carousel_remap(index, -1);
+    carousel_update_extent();
+
+    if (s_cached_scene_count == 0) {
+        lv_obj_clear_flag(s_label_no_scenes, LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
+
+    // Removing the last card leaves the view past the end; move back onto it
+    lv_coord_t max_x = (s_cached_scene_count - 1) * (CARD_WIDTH + CARD_GAP);
+    if (lv_obj_get_scroll_x(s_carousel) > max_x) {
+        lv_obj_scroll_to_x(s_carousel, max_x, LV_ANIM_ON);
+    }
+
+    carousel_bind_window(carousel_center_index());
+    update_card_selection(s_scenes_state.current_scene_index);
 }
 
 /**
@@ -1185,12 +1665,12 @@ void ui_scenes_update_progress(uint8_t percent)
     if (percent > 0 && percent < 100) {
         // Show progress bar during transition
         lv_obj_clear_flag(s_progress_bar, LV_OBJ_FLAG_HIDDEN);
-        lv_bar_set_value(s_progress_bar, percent, LV_ANIM_OFF);
+        progress_bar_set(percent);
         s_scenes_state.transition_in_progress = true;
     } else {
         // Hide progress bar when complete or not started
         lv_obj_add_flag(s_progress_bar, LV_OBJ_FLAG_HIDDEN);
-        lv_bar_set_value(s_progress_bar, 0, LV_ANIM_OFF);
+        progress_bar_set(0);
         s_scenes_state.transition_in_progress = false;
     }
 }
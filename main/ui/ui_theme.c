@@ -0,0 +1,132 @@
+/**
+ * @file ui_theme.c
+ * @brief Shared static styles for the scene and manual control tabs
+ */
+
+#include "ui_theme.h"
+#include <stdbool.h>
+
+static lv_style_t s_styles[UI_STYLE_COUNT];
+static bool s_initialized = false;
+
+static void init_font(ui_style_id_t id, const lv_font_t *font)
+{
+    lv_style_set_text_font(&s_styles[id], font);
+}
+
+static void init_btn_color(ui_style_id_t id, lv_color_t color)
+{
+    lv_style_set_bg_color(&s_styles[id], color);
+}
+
+void ui_theme_init(void)
+{
+    if (s_initialized) {
+        return;
+    }
+
+    for (int i = 0; i < UI_STYLE_COUNT; i++) {
+        lv_style_init(&s_styles[i]);
+    }
+
+    // Containers (no shadows on cards for smooth scroll performance)
+    lv_style_t *style = &s_styles[UI_STYLE_CARD];
+    lv_style_set_bg_color(style, lv_color_white());
+    lv_style_set_radius(style, 16);
+    lv_style_set_border_width(style, 2);
+    lv_style_set_border_color(style, UI_COLOR_BORDER);
+    lv_style_set_pad_all(style, 0);
+
+    style = &s_styles[UI_STYLE_CARD_SELECTED];
+    lv_style_set_border_width(style, 4);
+    lv_style_set_border_color(style, UI_COLOR_BLUE);
+
+    style = &s_styles[UI_STYLE_MODAL_OVERLAY];
+    lv_style_set_bg_color(style, lv_color_black());
+    lv_style_set_bg_opa(style, LV_OPA_50);
+    lv_style_set_border_width(style, 0);
+    lv_style_set_radius(style, 0);
+
+    style = &s_styles[UI_STYLE_MODAL_DIALOG];
+    lv_style_set_bg_color(style, lv_color_white());
+    lv_style_set_radius(style, 12);
+    lv_style_set_shadow_width(style, 20);
+    lv_style_set_shadow_opa(style, LV_OPA_30);
+    lv_style_set_pad_all(style, 20);
+
+    lv_style_set_pad_all(&s_styles[UI_STYLE_MODAL_COMPACT], 15);
+
+    style = &s_styles[UI_STYLE_CONTAINER];
+    lv_style_set_bg_opa(style, LV_OPA_TRANSP);
+    lv_style_set_border_width(style, 0);
+    lv_style_set_pad_all(style, 0);
+
+    lv_style_set_radius(&s_styles[UI_STYLE_CIRCLE], LV_RADIUS_CIRCLE);
+    lv_style_set_radius(&s_styles[UI_STYLE_RADIUS_SMALL], 6);
+    lv_style_set_radius(&s_styles[UI_STYLE_BAR], 8);
+
+    style = &s_styles[UI_STYLE_WHEEL_CURSOR];
+    lv_style_set_radius(style, LV_RADIUS_CIRCLE);
+    lv_style_set_border_width(style, 4);
+    lv_style_set_border_color(style, lv_color_white());
+    lv_style_set_outline_width(style, 1);
+    lv_style_set_outline_color(style, UI_COLOR_TEXT);
+
+    // Buttons; text colour and font are inherited by the button's label
+    style = &s_styles[UI_STYLE_BTN];
+    lv_style_set_radius(style, 8);
+    lv_style_set_text_color(style, lv_color_white());
+
+    style = &s_styles[UI_STYLE_BTN_RAISED];
+    lv_style_set_bg_opa(style, LV_OPA_COVER);
+    lv_style_set_shadow_width(style, 4);
+    lv_style_set_shadow_opa(style, LV_OPA_30);
+
+    init_btn_color(UI_STYLE_BTN_BLUE, UI_COLOR_BLUE);
+    init_btn_color(UI_STYLE_BTN_GREEN, UI_COLOR_GREEN);
+    init_btn_color(UI_STYLE_BTN_RED, UI_COLOR_RED);
+    init_btn_color(UI_STYLE_BTN_GRAY, UI_COLOR_GRAY);
+    init_btn_color(UI_STYLE_BTN_ORANGE, UI_COLOR_ORANGE);
+
+    // Text
+    lv_style_set_text_color(&s_styles[UI_STYLE_TEXT], UI_COLOR_TEXT);
+    lv_style_set_text_color(&s_styles[UI_STYLE_TEXT_SECONDARY], UI_COLOR_TEXT_SECONDARY);
+    lv_style_set_text_color(&s_styles[UI_STYLE_TEXT_MUTED], UI_COLOR_TEXT_MUTED);
+    lv_style_set_text_color(&s_styles[UI_STYLE_TEXT_DARK], UI_COLOR_TEXT_DARK);
+    lv_style_set_text_color(&s_styles[UI_STYLE_TEXT_DANGER], UI_COLOR_RED);
+
+    init_font(UI_STYLE_FONT_14, &lv_font_montserrat_14);
+    init_font(UI_STYLE_FONT_16, &lv_font_montserrat_16);
+    init_font(UI_STYLE_FONT_18, &lv_font_montserrat_18);
+    init_font(UI_STYLE_FONT_20, &lv_font_montserrat_20);
+    init_font(UI_STYLE_FONT_24, &lv_font_montserrat_24);
+    init_font(UI_STYLE_FONT_28, &lv_font_montserrat_28);
+    init_font(UI_STYLE_FONT_32, &lv_font_montserrat_32);
+
+    // Inputs
+    style = &s_styles[UI_STYLE_TEXTAREA];
+    lv_style_set_border_color(style, UI_COLOR_TRACK);
+    lv_style_set_border_width(style, 2);
+    lv_style_set_radius(style, 8);
+
+    style = &s_styles[UI_STYLE_SLIDER_TRACK];
+    lv_style_set_bg_color(style, UI_COLOR_TRACK);
+    lv_style_set_border_width(style, 0);
+
+    lv_style_set_bg_color(&s_styles[UI_STYLE_SLIDER_ACCENT], UI_COLOR_BLUE);
+    lv_style_set_pad_all(&s_styles[UI_STYLE_SLIDER_KNOB_LARGE], 5);
+
+    s_initialized = true;
+}
+
+lv_style_t *ui_style(ui_style_id_t id)
+{
+    return &s_styles[id];
+}
+
+void ui_theme_style_btn(lv_obj_t *btn, ui_style_id_t color, ui_style_id_t font)
+{
+    lv_obj_add_style(btn, &s_styles[UI_STYLE_BTN], LV_PART_MAIN);
+    lv_obj_add_style(btn, &s_styles[color], LV_PART_MAIN);
+    lv_obj_add_style(btn, &s_styles[font], LV_PART_MAIN);
+}
@@ -0,0 +1,105 @@
+/**
+ * @file ui_theme.h
+ * @brief Shared static styles for the scene and manual control tabs
+ *
+ * Each style is a single static lv_style_t added with lv_obj_add_style(),
+ * so widgets share one property list instead of each allocating local
+ * style properties through lv_obj_set_style_*(). Styles are composed:
+ * e.g. a green modal button gets UI_STYLE_BTN, UI_STYLE_BTN_GREEN and a
+ * font style. Per-object lv_obj_set_style_*() calls remain only for
+ * values that differ per object (such as a colour preview).
+ */
+
+#pragma once
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Palette (Material colours used across the UI)
+#define UI_COLOR_BLUE           lv_color_make(33, 150, 243)     ///< #2196F3
+#define UI_COLOR_GREEN          lv_color_make(76, 175, 80)      ///< #4CAF50
+#define UI_COLOR_RED            lv_color_make(244, 67, 54)      ///< #F44336
+#define UI_COLOR_ORANGE         lv_color_make(255, 152, 0)      ///< #FF9800
+#define UI_COLOR_GRAY           lv_color_make(158, 158, 158)    ///< #9E9E9E
+#define UI_COLOR_TRACK          lv_color_make(189, 189, 189)    ///< Slider track, input border
+#define UI_COLOR_BORDER         lv_color_make(224, 224, 224)    ///< Unselected card border
+#define UI_COLOR_TEXT           lv_color_make(33, 33, 33)       ///< Primary text
+#define UI_COLOR_TEXT_DARK      lv_color_make(51, 51, 51)       ///< Control labels (#333333)
+#define UI_COLOR_TEXT_SECONDARY lv_color_make(97, 97, 97)       ///< Field labels
+#define UI_COLOR_TEXT_MUTED     lv_color_make(117, 117, 117)    ///< Values, hints
+
+/**
+ * @brief Shared styles
+ */
+typedef enum {
+    // Containers
+    UI_STYLE_CARD,              ///< Scene card: white, radius 16, 2 px light border
+    UI_STYLE_CARD_SELECTED,     ///< Added on top of UI_STYLE_CARD: 4 px blue border
+    UI_STYLE_MODAL_OVERLAY,     ///< Full-screen 50% black backdrop
+    UI_STYLE_MODAL_DIALOG,      ///< White dialog box, radius 12, soft shadow, pad 20
+    UI_STYLE_MODAL_COMPACT,     ///< Added on top of UI_STYLE_MODAL_DIALOG: pad 15
+    UI_STYLE_CONTAINER,         ///< Invisible layout container (no bg, border or pad)
+    UI_STYLE_CIRCLE,            ///< Round shape (colour previews)
+    UI_STYLE_RADIUS_SMALL,      ///< Radius 6 (small buttons, inline inputs)
+    UI_STYLE_BAR,               ///< Radius 8 for bar main and indicator parts
+    UI_STYLE_WHEEL_CURSOR,      ///< Hollow ring: 4 px white border, 1 px dark outline
+    // Buttons (combine UI_STYLE_BTN with one colour)
+    UI_STYLE_BTN,               ///< Radius 8, white text
+    UI_STYLE_BTN_RAISED,        ///< Opaque with a small shadow (main action buttons)
+    UI_STYLE_BTN_BLUE,
+    UI_STYLE_BTN_GREEN,
+    UI_STYLE_BTN_RED,
+    UI_STYLE_BTN_GRAY,
+    UI_STYLE_BTN_ORANGE,
+    // Text colour
+    UI_STYLE_TEXT,              ///< Primary text colour
+    UI_STYLE_TEXT_SECONDARY,
+    UI_STYLE_TEXT_MUTED,
+    UI_STYLE_TEXT_DARK,
+    UI_STYLE_TEXT_DANGER,       ///< Red text (destructive action titles)
+    // Fonts
+    UI_STYLE_FONT_14,
+    UI_STYLE_FONT_16,
+    UI_STYLE_FONT_18,
+    UI_STYLE_FONT_20,
+    UI_STYLE_FONT_24,
+    UI_STYLE_FONT_28,
+    UI_STYLE_FONT_32,
+    // Inputs
+    UI_STYLE_TEXTAREA,          ///< 2 px gray border, radius 8
+    UI_STYLE_SLIDER_TRACK,      ///< Slider main part: gray, no border
+    UI_STYLE_SLIDER_ACCENT,     ///< Slider indicator and knob: blue
+    UI_STYLE_SLIDER_KNOB_LARGE, ///< Slider knob padding for easier touch
+    UI_STYLE_COUNT
+} ui_style_id_t;
+
+/**
+ * @brief Initialize the shared styles (LVGL context, idempotent)
+ *
+ * Call before creating any tab content.
+ */
+void ui_theme_init(void);
+
+/**
+ * @brief Get a shared style for lv_obj_add_style()
+ *
+ * @param id Style identifier
+ * @return Pointer to the static style
+ */
+lv_style_t *ui_style(ui_style_id_t id);
+
+/**
+ * @brief Style a button: UI_STYLE_BTN plus a colour and a font for its label
+ *
+ * @param btn Button
+ * @param color One of the UI_STYLE_BTN_<colour> styles
+ * @param font One of the UI_STYLE_FONT_<size> styles
+ */
+void ui_theme_style_btn(lv_obj_t *btn, ui_style_id_t color, ui_style_id_t font);
+
+#ifdef __cplusplus
+}
+#endif